@@ -7,7 +7,7 @@
 *@brief     Rate limiter for general use
 *@author    Ziga Miklosic
 *@date      19.02.2021
-*@version   V1.0.1
+*@version   V1.1.0
 *
 *@section Description
 *
@@ -52,32 +52,123 @@
 // Includes
 ////////////////////////////////////////////////////////////////////////////////
 #include "rate_limiter.h"
+#include "rate_limiter_kernel.h"
+
+#include <math.h>
+
+#if ( 1 == RATE_LIMITER_ATOMIC_EN )
+	#include <stdatomic.h>
+
+	#if ( 2 != ATOMIC_LLONG_LOCK_FREE )
+		#error "RATE_LIMITER_ATOMIC_EN requires lock-free 64-bit atomics!"
+	#endif
+#endif
 
 
 ////////////////////////////////////////////////////////////////////////////////
 // Definitions
 ////////////////////////////////////////////////////////////////////////////////
 
+/**
+ * 	Instance memory origin
+ */
+typedef enum
+{
+	eRATE_LIMITER_MEM_HEAP = 0,		/**<Allocated on heap */
+	eRATE_LIMITER_MEM_POOL,			/**<Acquired from instance pool */
+	eRATE_LIMITER_MEM_USER,			/**<Provided by user */
+} rate_limiter_mem_t;
+
 /**
  * 	Slew rate limiter
  */
 typedef struct rate_limiter_s
 {
-	float32_t 	x_prev;		/**<Previous value of input */
-	float32_t 	k_rise;		/**<Rising slew rate factor*/
-	float32_t 	k_fall;		/**<Falling slew rate factor*/
-	float32_t 	dt;			/**<Period of update */
-	bool		is_init;	/**<Rate limiter initialization success flag */
+#if ( 1 == RATE_LIMITER_ATOMIC_EN )
+	_Atomic uint64_t	k_pair;		/**<Packed rising/falling slew rate factors */
+	_Atomic uint64_t	rate_pair;	/**<Packed rising/falling slew rates */
+#else
+	float32_t 			k_rise;		/**<Rising slew rate factor*/
+	float32_t 			k_fall;		/**<Falling slew rate factor*/
+	float32_t			rise_rate;	/**<Rising slew rate */
+	float32_t			fall_rate;	/**<Falling slew rate */
+#endif
+	float32_t 			x_prev;		/**<Previous value of input */
+	float32_t 			dt;			/**<Period of update */
+	bool				is_init;	/**<Rate limiter initialization success flag */
+	uint8_t				mem;		/**<Instance memory origin, see rate_limiter_mem_t */
 } rate_limiter_t;
 
+/**
+ * 	Compact instance initialization sentinel
+ */
+#define RATE_LIMITER_COMPACT_INIT_MAGIC		( 0x524C494EUL )
+
+/**
+ * 	Compile time check that public storage can hold instance
+ */
+typedef char rate_limiter_storage_check_t[( sizeof( rate_limiter_t ) <= RATE_LIMITER_STORAGE_SIZE ) ? 1 : -1 ];
+
+/**
+ * 	Compile time check of fixed snapshot layout
+ */
+typedef char rate_limiter_snapshot_check_t[(( 64U == sizeof( rate_limiter_snapshot_header_t )) && ( 96U == sizeof( rate_limiter_snapshot_t ))) ? 1 : -1 ];
+
+/**
+ * 	Required alignment of instance memory
+ */
+#if ( 1 == RATE_LIMITER_ATOMIC_EN )
+	#define RATE_LIMITER_INST_ALIGN			( sizeof( uint64_t ))
+#else
+	#define RATE_LIMITER_INST_ALIGN			( sizeof( float32_t ))
+#endif
+
 ////////////////////////////////////////////////////////////////////////////////
 // Variables
 ////////////////////////////////////////////////////////////////////////////////
 
+#if ( RATE_LIMITER_POOL_SIZE > 0 )
+
+	/**
+	 * 	Instance pool slab
+	 */
+	static rate_limiter_t g_rate_limiter_pool[RATE_LIMITER_POOL_SIZE];
+
+	/**
+	 * 	Stack of free pool slot indexes
+	 */
+	static uint32_t g_rate_limiter_pool_free[RATE_LIMITER_POOL_SIZE];
+
+	/**
+	 * 	Number of free pool slots
+	 */
+	static uint32_t g_rate_limiter_pool_num_of_free = 0;
+
+	/**
+	 * 	Pool initialization flag
+	 */
+	static bool g_rate_limiter_pool_is_init = false;
+
+#endif
+
 ////////////////////////////////////////////////////////////////////////////////
 // Function prototypes
 ////////////////////////////////////////////////////////////////////////////////
-static float32_t rate_limiter_calc_rate_factor(const float32_t dt, const float32_t slew_rate);
+static void 		rate_limiter_setup		(p_rate_limiter_t rl_inst, const float32_t rise_rate, const float32_t fall_rate, const float32_t dt);
+static inline void	rate_limiter_get_k		(p_rate_limiter_t rl_inst, float32_t * const p_k_rise, float32_t * const p_k_fall);
+static inline void	rate_limiter_set_k		(p_rate_limiter_t rl_inst, const float32_t k_rise, const float32_t k_fall);
+static inline void	rate_limiter_get_rate	(p_rate_limiter_t rl_inst, float32_t * const p_rise_rate, float32_t * const p_fall_rate);
+static inline void	rate_limiter_set_rate	(p_rate_limiter_t rl_inst, const float32_t rise_rate, const float32_t fall_rate);
+
+#if ( 1 == RATE_LIMITER_ATOMIC_EN )
+	static inline uint64_t	rate_limiter_pack	(const float32_t lo, const float32_t hi);
+	static inline void		rate_limiter_unpack	(const uint64_t pair, float32_t * const p_lo, float32_t * const p_hi);
+#endif
+
+#if ( RATE_LIMITER_POOL_SIZE > 0 )
+	static p_rate_limiter_t	rate_limiter_pool_acquire	(void);
+	static void				rate_limiter_pool_release	(p_rate_limiter_t rl_inst);
+#endif
 
 ////////////////////////////////////////////////////////////////////////////////
 // Functions
@@ -85,22 +176,217 @@ static float32_t rate_limiter_calc_rate_factor(const float32_t dt, const float32
 
 ////////////////////////////////////////////////////////////////////////////////
 /*!
-* @brief    Calculate slew rate factor base on update time.
+* @brief    Setup rate limiter instance
 *
+* @param[in]  	rl_inst		- Pointer to rate limiter instance
+* @param[in]  	rise_rate	- Rising slew rate
+* @param[in]  	fall_rate	- Falling slew rate
 * @param[in]  	dt			- Update (period) time
-* @param[in]	slew_rate	- Wanted slew rate
-* @return       k_rate		- Slew rate factor
+* @return       void
 */
 ////////////////////////////////////////////////////////////////////////////////
-static float32_t rate_limiter_calc_rate_factor(const float32_t dt, const float32_t slew_rate)
+static void rate_limiter_setup(p_rate_limiter_t rl_inst, const float32_t rise_rate, const float32_t fall_rate, const float32_t dt)
 {
-	float32_t k_rate = 0.0f;
+	// Init previous value & period
+	rl_inst->x_prev = 0.0f;
+	rl_inst->dt = dt;
+
+	// Store rates for variable period update
+	rate_limiter_set_rate( rl_inst, rise_rate, fall_rate );
 
-	k_rate = ( slew_rate * dt );
+	// Calculate rise/fall factors
+	rate_limiter_set_k( rl_inst, rate_limiter_calc_rate_factor( dt, rise_rate ), rate_limiter_calc_rate_factor( dt, fall_rate ));
 
-	return k_rate;
+	// Init success
+	rl_inst->is_init = true;
 }
 
+#if ( 1 == RATE_LIMITER_ATOMIC_EN )
+
+	////////////////////////////////////////////////////////////////////////////////
+	/*!
+	* @brief    Pack two float values into single 64-bit word
+	*
+	* @param[in]  	lo			- Value in lower 32 bits
+	* @param[in]  	hi			- Value in upper 32 bits
+	* @return       pair		- Packed values
+	*/
+	////////////////////////////////////////////////////////////////////////////////
+	static inline uint64_t rate_limiter_pack(const float32_t lo, const float32_t hi)
+	{
+		rate_limiter_bits_t lo_bits;
+		rate_limiter_bits_t hi_bits;
+
+		lo_bits.f = lo;
+		hi_bits.f = hi;
+
+		return (((uint64_t) hi_bits.u << 32U ) | (uint64_t) lo_bits.u );
+	}
+
+	////////////////////////////////////////////////////////////////////////////////
+	/*!
+	* @brief    Unpack two float values from single 64-bit word
+	*
+	* @param[in]  	pair		- Packed values
+	* @param[out]  	p_lo		- Value from lower 32 bits
+	* @param[out]  	p_hi		- Value from upper 32 bits
+	* @return       void
+	*/
+	////////////////////////////////////////////////////////////////////////////////
+	static inline void rate_limiter_unpack(const uint64_t pair, float32_t * const p_lo, float32_t * const p_hi)
+	{
+		rate_limiter_bits_t lo_bits;
+		rate_limiter_bits_t hi_bits;
+
+		lo_bits.u = (uint32_t)( pair & 0xFFFFFFFFULL );
+		hi_bits.u = (uint32_t)( pair >> 32U );
+
+		*p_lo = lo_bits.f;
+		*p_hi = hi_bits.f;
+	}
+
+#endif
+
+////////////////////////////////////////////////////////////////////////////////
+/*!
+* @brief    Get slew rate factors
+*
+* @note With RATE_LIMITER_ATOMIC_EN both factors are read with single
+* 		atomic load, thus always belong to the same rate change.
+*
+* @param[in]  	rl_inst		- Pointer to rate limiter instance
+* @param[out]  	p_k_rise	- Rising slew rate factor
+* @param[out]  	p_k_fall	- Falling slew rate factor
+* @return       void
+*/
+////////////////////////////////////////////////////////////////////////////////
+static inline void rate_limiter_get_k(p_rate_limiter_t rl_inst, float32_t * const p_k_rise, float32_t * const p_k_fall)
+{
+	#if ( 1 == RATE_LIMITER_ATOMIC_EN )
+		rate_limiter_unpack( atomic_load_explicit( &rl_inst->k_pair, memory_order_relaxed ), p_k_rise, p_k_fall );
+	#else
+		*p_k_rise = rl_inst->k_rise;
+		*p_k_fall = rl_inst->k_fall;
+	#endif
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/*!
+* @brief    Set slew rate factors
+*
+* @note With RATE_LIMITER_ATOMIC_EN both factors are written with single
+* 		atomic store.
+*
+* @param[in]  	rl_inst		- Pointer to rate limiter instance
+* @param[in]  	k_rise		- Rising slew rate factor
+* @param[in]  	k_fall		- Falling slew rate factor
+* @return       void
+*/
+////////////////////////////////////////////////////////////////////////////////
+static inline void rate_limiter_set_k(p_rate_limiter_t rl_inst, const float32_t k_rise, const float32_t k_fall)
+{
+	#if ( 1 == RATE_LIMITER_ATOMIC_EN )
+		atomic_store_explicit( &rl_inst->k_pair, rate_limiter_pack( k_rise, k_fall ), memory_order_relaxed );
+	#else
+		rl_inst->k_rise = k_rise;
+		rl_inst->k_fall = k_fall;
+	#endif
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/*!
+* @brief    Get slew rates
+*
+* @param[in]  	rl_inst		- Pointer to rate limiter instance
+* @param[out]  	p_rise_rate	- Rising slew rate
+* @param[out]  	p_fall_rate	- Falling slew rate
+* @return       void
+*/
+////////////////////////////////////////////////////////////////////////////////
+static inline void rate_limiter_get_rate(p_rate_limiter_t rl_inst, float32_t * const p_rise_rate, float32_t * const p_fall_rate)
+{
+	#if ( 1 == RATE_LIMITER_ATOMIC_EN )
+		rate_limiter_unpack( atomic_load_explicit( &rl_inst->rate_pair, memory_order_relaxed ), p_rise_rate, p_fall_rate );
+	#else
+		*p_rise_rate = rl_inst->rise_rate;
+		*p_fall_rate = rl_inst->fall_rate;
+	#endif
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/*!
+* @brief    Set slew rates
+*
+* @param[in]  	rl_inst		- Pointer to rate limiter instance
+* @param[in]  	rise_rate	- Rising slew rate
+* @param[in]  	fall_rate	- Falling slew rate
+* @return       void
+*/
+////////////////////////////////////////////////////////////////////////////////
+static inline void rate_limiter_set_rate(p_rate_limiter_t rl_inst, const float32_t rise_rate, const float32_t fall_rate)
+{
+	#if ( 1 == RATE_LIMITER_ATOMIC_EN )
+		atomic_store_explicit( &rl_inst->rate_pair, rate_limiter_pack( rise_rate, fall_rate ), memory_order_relaxed );
+	#else
+		rl_inst->rise_rate = rise_rate;
+		rl_inst->fall_rate = fall_rate;
+	#endif
+}
+
+
+#if ( RATE_LIMITER_POOL_SIZE > 0 )
+
+	////////////////////////////////////////////////////////////////////////////////
+	/*!
+	* @brief    Acquire instance from pool
+	*
+	* @note Free slots are kept on stack of indexes, thus acquire is O(1).
+	* 		On first call all slots are put on free stack.
+	*
+	* @return       rl_inst		- Pointer to instance, NULL if pool is empty
+	*/
+	////////////////////////////////////////////////////////////////////////////////
+	static p_rate_limiter_t rate_limiter_pool_acquire(void)
+	{
+		p_rate_limiter_t 	rl_inst = NULL;
+		uint32_t			i		= 0;
+
+		if ( false == g_rate_limiter_pool_is_init )
+		{
+			for ( i = 0; i < RATE_LIMITER_POOL_SIZE; i++ )
+			{
+				g_rate_limiter_pool_free[i] = (( RATE_LIMITER_POOL_SIZE - 1U ) - i );
+			}
+
+			g_rate_limiter_pool_num_of_free = RATE_LIMITER_POOL_SIZE;
+			g_rate_limiter_pool_is_init = true;
+		}
+
+		if ( g_rate_limiter_pool_num_of_free > 0U )
+		{
+			g_rate_limiter_pool_num_of_free--;
+			rl_inst = &g_rate_limiter_pool[ g_rate_limiter_pool_free[ g_rate_limiter_pool_num_of_free ]];
+		}
+
+		return rl_inst;
+	}
+
+	////////////////////////////////////////////////////////////////////////////////
+	/*!
+	* @brief    Release instance back to pool
+	*
+	* @param[in]  	rl_inst		- Pointer to instance acquired from pool
+	* @return       void
+	*/
+	////////////////////////////////////////////////////////////////////////////////
+	static void rate_limiter_pool_release(p_rate_limiter_t rl_inst)
+	{
+		g_rate_limiter_pool_free[ g_rate_limiter_pool_num_of_free ] = (uint32_t)( rl_inst - &g_rate_limiter_pool[0] );
+		g_rate_limiter_pool_num_of_free++;
+	}
+
+#endif
+
 ////////////////////////////////////////////////////////////////////////////////
 /**
 * @} <!-- END GROUP -->
@@ -126,6 +412,9 @@ static float32_t rate_limiter_calc_rate_factor(const float32_t dt, const float32
 * 			- for 1V/s -> put rise/fall rate = 1.0
 * 			- for 0.5V/s -> put rise/fall rate = 0.5
 *
+* @note With RATE_LIMITER_POOL_SIZE set, instance is acquired from static
+* 		instance pool instead of heap.
+*
 * @param[out]  	p_rl_inst	- Pointer to rate limiter instance
 * @param[in]  	rise_rate	- Rising slew rate
 * @param[in]  	fall_rate	- Falling slew rate
@@ -141,21 +430,70 @@ rate_limiter_status_t rate_limiter_init(p_rate_limiter_t * p_rl_inst, const floa
 		&& 	( dt > 0.0f ))
 	{
 		// Allocate space
-		*p_rl_inst = malloc( sizeof( rate_limiter_t ));
+		#if ( RATE_LIMITER_POOL_SIZE > 0 )
+			*p_rl_inst = rate_limiter_pool_acquire();
+		#else
+			*p_rl_inst = malloc( sizeof( rate_limiter_t ));
+		#endif
 
 		if ( NULL != *p_rl_inst )
 		{
-			// Init previous value & period
-			(*p_rl_inst)->x_prev = 0.0f;
-			(*p_rl_inst)->dt = dt;
+			rate_limiter_setup( *p_rl_inst, rise_rate, fall_rate, dt );
 
-			// Calculate rise/fall factors
-			(*p_rl_inst)->k_rise = rate_limiter_calc_rate_factor( dt, rise_rate );
-			(*p_rl_inst)->k_fall = rate_limiter_calc_rate_factor( dt, fall_rate );
-
-			// Init success
-			(*p_rl_inst)->is_init = true;
+			#if ( RATE_LIMITER_POOL_SIZE > 0 )
+				(*p_rl_inst)->mem = eRATE_LIMITER_MEM_POOL;
+			#else
+				(*p_rl_inst)->mem = eRATE_LIMITER_MEM_HEAP;
+			#endif
 		}
+		else
+		{
+			status = eRATE_LIMITER_ERROR;
+		}
+	}
+	else
+	{
+		status = eRATE_LIMITER_ERROR;
+	}
+
+	return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/*!
+* @brief    Initialize rate limiter in caller provided memory
+*
+* @note No dynamic allocation is made. Memory shall be at least
+* 		RATE_LIMITER_STORAGE_SIZE bytes large and aligned as
+* 		"rate_limiter_storage_t" (float32_t, 64-bit with atomic mode),
+* 		e.g. "rate_limiter_storage_t" placed in static memory, on stack or
+* 		inside user object. Memory must stay valid for the whole lifetime
+* 		of the instance.
+*
+* 		Slew rate units are the same as with "rate_limiter_init()".
+*
+* @param[out]  	p_rl_inst	- Pointer to rate limiter instance
+* @param[in]  	p_mem		- Pointer to instance storage
+* @param[in]  	rise_rate	- Rising slew rate
+* @param[in]  	fall_rate	- Falling slew rate
+* @param[in]  	dt			- Update (period) time
+* @return       status		- Either OK or Error
+*/
+////////////////////////////////////////////////////////////////////////////////
+rate_limiter_status_t rate_limiter_init_in_place(p_rate_limiter_t * p_rl_inst, void * const p_mem, const float32_t rise_rate, const float32_t fall_rate, const float32_t dt)
+{
+	rate_limiter_status_t status = eRATE_LIMITER_OK;
+
+	if 	(	( NULL != p_rl_inst )
+		&&	( NULL != p_mem )
+		&&	( 0U == ((uintptr_t) p_mem % RATE_LIMITER_INST_ALIGN ))
+		&& 	( dt > 0.0f ))
+	{
+		*p_rl_inst = (p_rate_limiter_t) p_mem;
+
+		rate_limiter_setup( *p_rl_inst, rise_rate, fall_rate, dt );
+
+		(*p_rl_inst)->mem = eRATE_LIMITER_MEM_USER;
 	}
 	else
 	{
@@ -165,6 +503,55 @@ rate_limiter_status_t rate_limiter_init(p_rate_limiter_t * p_rl_inst, const floa
 	return status;
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/*!
+* @brief    De-initialize rate limiter
+*
+* @note Instance memory is returned to where it came from: freed to heap,
+* 		released back to instance pool or, for caller provided storage,
+* 		just marked as not initialized. Instance pointer is set to NULL.
+*
+* @param[in,out]  	p_rl_inst	- Pointer to rate limiter instance
+* @return       	status		- Either OK or Error
+*/
+////////////////////////////////////////////////////////////////////////////////
+rate_limiter_status_t rate_limiter_deinit(p_rate_limiter_t * p_rl_inst)
+{
+	rate_limiter_status_t status = eRATE_LIMITER_ERROR;
+
+	// Check for instance and initialization
+	if ( NULL != p_rl_inst )
+	{
+		if ( true == rate_limiter_is_init( *p_rl_inst ))
+		{
+			(*p_rl_inst)->is_init = false;
+
+			if ( eRATE_LIMITER_MEM_HEAP == (*p_rl_inst)->mem )
+			{
+				free( *p_rl_inst );
+			}
+
+			#if ( RATE_LIMITER_POOL_SIZE > 0 )
+				else if ( eRATE_LIMITER_MEM_POOL == (*p_rl_inst)->mem )
+				{
+					rate_limiter_pool_release( *p_rl_inst );
+				}
+			#endif
+
+			else
+			{
+				// User storage, nothing to release...
+			}
+
+			*p_rl_inst = NULL;
+
+			status = eRATE_LIMITER_OK;
+		}
+	}
+
+	return status;
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /*!
 * @brief    Update rate limiter
@@ -179,35 +566,165 @@ rate_limiter_status_t rate_limiter_init(p_rate_limiter_t * p_rl_inst, const floa
 ////////////////////////////////////////////////////////////////////////////////
 float32_t rate_limiter_update(p_rate_limiter_t rl_inst, const float32_t x)
 {
-	float32_t y = 0.0f;
-	float32_t dx = 0.0f;
+	float32_t y 		= 0.0f;
+	float32_t k_rise	= 0.0f;
+	float32_t k_fall	= 0.0f;
 
 	// Check for instance and initialization
 	if ( NULL != rl_inst )
 	{
 		if ( true == rl_inst->is_init )
 		{
-			// Calculate change
-			dx = x - rl_inst->x_prev;
+			rate_limiter_get_k( rl_inst, &k_rise, &k_fall );
 
-			// Rising limit
-			if ( dx >= rl_inst->k_rise )
+			// Apply slew limits
+			y = rate_limiter_limit( x, rl_inst->x_prev, k_rise, k_fall );
+
+			// Store current value
+			rl_inst->x_prev = y;
+		}
+	}
+
+	return y;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/*!
+* @brief    Update rate limiter with variable period
+*
+* @note For jittery or event driven call sites. Slew rate factors are
+* 		calculated from actual elapsed time on each call, so that
+* 		limiting stays correct regardless of call period. Period given at
+* 		initialization is not changed. On invalid (not positive or NaN)
+* 		period output holds previous value.
+*
+* @param[in]  	rl_inst		- Pointer to rate limiter instance
+* @param[in]  	x			- Input signal
+* @param[in]  	dt			- Time elapsed since previous update, shall be positive
+* @return       y			- Output (slew limited) signal
+*/
+////////////////////////////////////////////////////////////////////////////////
+float32_t rate_limiter_update_dt(p_rate_limiter_t rl_inst, const float32_t x, const float32_t dt)
+{
+	float32_t y 		= 0.0f;
+	float32_t rise_rate	= 0.0f;
+	float32_t fall_rate	= 0.0f;
+
+	// Check for instance and initialization
+	if ( NULL != rl_inst )
+	{
+		if ( true == rl_inst->is_init )
+		{
+			// Negative or NaN period would invert or skip limits
+			if ( dt > 0.0f )
 			{
-				y = rl_inst->x_prev + rl_inst->k_rise;
+				rate_limiter_get_rate( rl_inst, &rise_rate, &fall_rate );
+
+				// Apply slew limits for elapsed time
+				y = rate_limiter_limit( x, rl_inst->x_prev, rate_limiter_calc_rate_factor( dt, rise_rate ), rate_limiter_calc_rate_factor( dt, fall_rate ));
+
+				// Store current value
+				rl_inst->x_prev = y;
 			}
 
-			// Falling limit
-			else if ( dx <= -( rl_inst->k_fall ))
+			// Invalid period, hold output
+			else
 			{
-				y = rl_inst->x_prev - rl_inst->k_fall;
+				y = rl_inst->x_prev;
 			}
+		}
+	}
 
-			// No limitations...
-			else
+	return y;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/*!
+* @brief    Update rate limiter over block of samples
+*
+* @note Instance is validated only once per block and previous value is kept
+* 		local for the whole block, thus per sample cost is much lower than
+* 		calling "rate_limiter_update()" for each sample. Result is bit exact
+* 		to the per sample update.
+*
+* 		Input and output buffer may point to the same location (in-place
+* 		processing).
+*
+* @param[in]  	rl_inst		- Pointer to rate limiter instance
+* @param[in]  	p_x			- Pointer to input signal samples
+* @param[out]  	p_y			- Pointer to output (slew limited) signal samples
+* @param[in]  	size		- Number of samples in block
+* @return       status		- Either OK or Error
+*/
+////////////////////////////////////////////////////////////////////////////////
+rate_limiter_status_t rate_limiter_update_block(p_rate_limiter_t rl_inst, const float32_t * const p_x, float32_t * const p_y, const size_t size)
+{
+	rate_limiter_status_t 	status 	= eRATE_LIMITER_ERROR;
+	float32_t				x_prev	= 0.0f;
+	float32_t				k_rise	= 0.0f;
+	float32_t				k_fall	= 0.0f;
+	size_t					i		= 0;
+
+	// Check for instance, initialization and buffers
+	if 	(	( NULL != rl_inst )
+		&&	( NULL != p_x )
+		&&	( NULL != p_y ))
+	{
+		if ( true == rl_inst->is_init )
+		{
+			// Take local copy of state
+			x_prev = rl_inst->x_prev;
+			rate_limiter_get_k( rl_inst, &k_rise, &k_fall );
+
+			for ( i = 0; i < size; i++ )
 			{
-				y = x;
+				x_prev = rate_limiter_limit( p_x[i], x_prev, k_rise, k_fall );
+				p_y[i] = x_prev;
 			}
 
+			// Store state back
+			rl_inst->x_prev = x_prev;
+
+			status = eRATE_LIMITER_OK;
+		}
+	}
+
+	return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/*!
+* @brief    Advance rate limiter for multiple steps with constant input
+*
+* @note Equivalent to calling "rate_limiter_update()" n_steps times with
+* 		the same input, but computed in constant time. Intended for
+* 		catching up missed update periods or resuming parked instance.
+*
+* 		Result is exact in real arithmetic, but can differ from iterated
+* 		updates in rounding of last bits when output is in saturation.
+*
+* @param[in]  	rl_inst		- Pointer to rate limiter instance
+* @param[in]  	x			- Input signal
+* @param[in]  	n_steps		- Number of update periods to advance
+* @return       y			- Output (slew limited) signal after n_steps
+*/
+////////////////////////////////////////////////////////////////////////////////
+float32_t rate_limiter_advance(p_rate_limiter_t rl_inst, const float32_t x, const uint32_t n_steps)
+{
+	float32_t y 		= 0.0f;
+	float32_t k_rise	= 0.0f;
+	float32_t k_fall	= 0.0f;
+
+	// Check for instance and initialization
+	if ( NULL != rl_inst )
+	{
+		if ( true == rl_inst->is_init )
+		{
+			rate_limiter_get_k( rl_inst, &k_rise, &k_fall );
+
+			// Apply slew limits over n steps
+			y = rate_limiter_limit_n( x, rl_inst->x_prev, k_rise, k_fall, n_steps );
+
 			// Store current value
 			rl_inst->x_prev = y;
 		}
@@ -216,6 +733,113 @@ float32_t rate_limiter_update(p_rate_limiter_t rl_inst, const float32_t x)
 	return y;
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/*!
+* @brief    Get number of update periods needed to reach target
+*
+* @note State of rate limiter is not changed. Result is computed in
+* 		constant time and is exact in real arithmetic.
+*
+* @param[in]  	rl_inst		- Pointer to rate limiter instance
+* @param[in]  	x			- Target (constant input signal)
+* @return       n_steps		- Number of update periods until output equals
+* 							  target, RATE_LIMITER_STEPS_INF if it is never
+* 							  reached (zero slew rate)
+*/
+////////////////////////////////////////////////////////////////////////////////
+uint32_t rate_limiter_steps_to_target(p_rate_limiter_t rl_inst, const float32_t x)
+{
+	uint32_t 	n_steps = 0;
+	float32_t	dx		= 0.0f;
+	float32_t	k_rise	= 0.0f;
+	float32_t	k_fall	= 0.0f;
+	float32_t	k_rate	= 0.0f;
+	float32_t	steps	= 0.0f;
+
+	// Check for instance and initialization
+	if ( NULL != rl_inst )
+	{
+		if ( true == rl_inst->is_init )
+		{
+			rate_limiter_get_k( rl_inst, &k_rise, &k_fall );
+
+			dx = x - rl_inst->x_prev;
+
+			// Distance & rate in direction of target
+			if ( dx > 0.0f )
+			{
+				k_rate = k_rise;
+			}
+			else if ( dx < 0.0f )
+			{
+				dx = -dx;
+				k_rate = k_fall;
+			}
+			else
+			{
+				// Already on target...
+			}
+
+			if ( dx > 0.0f )
+			{
+				if ( k_rate > 0.0f )
+				{
+					steps = ceilf( dx / k_rate );
+
+					// Saturate to range
+					if ( steps < (float32_t) RATE_LIMITER_STEPS_INF )
+					{
+						n_steps = (uint32_t) steps;
+					}
+					else
+					{
+						n_steps = RATE_LIMITER_STEPS_INF;
+					}
+				}
+				else
+				{
+					n_steps = RATE_LIMITER_STEPS_INF;
+				}
+			}
+		}
+	}
+
+	return n_steps;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/*!
+* @brief    Get output of rate limiter after given number of update periods
+*
+* @note State of rate limiter is not changed. Equal to output of
+* 		"rate_limiter_advance()" with the same arguments.
+*
+* @param[in]  	rl_inst		- Pointer to rate limiter instance
+* @param[in]  	x			- Input signal, constant over all periods
+* @param[in]  	n_steps		- Number of update periods
+* @return       y			- Output (slew limited) signal after n_steps
+*/
+////////////////////////////////////////////////////////////////////////////////
+float32_t rate_limiter_output_at(p_rate_limiter_t rl_inst, const float32_t x, const uint32_t n_steps)
+{
+	float32_t y 		= 0.0f;
+	float32_t k_rise	= 0.0f;
+	float32_t k_fall	= 0.0f;
+
+	// Check for instance and initialization
+	if ( NULL != rl_inst )
+	{
+		if ( true == rl_inst->is_init )
+		{
+			rate_limiter_get_k( rl_inst, &k_rise, &k_fall );
+
+			y = rate_limiter_limit_n( x, rl_inst->x_prev, k_rise, k_fall, n_steps );
+		}
+	}
+
+	return y;
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /*!
 * @brief    Get success initialization flag
@@ -242,6 +866,10 @@ bool rate_limiter_is_init(p_rate_limiter_t rl_inst)
 *
 * @note Slew rate limit has same logic as with initialization function.
 *
+* @note With RATE_LIMITER_ATOMIC_EN enabled it may be called from other
+* 		thread than update functions. Update always sees both slew rate
+* 		factors of the same change.
+*
 * @param[out]  	rl_inst		- Pointer to rate limiter instance
 * @param[in]  	rise_rate	- Rising slew rate
 * @param[in]  	fall_rate	- Falling slew rate
@@ -257,8 +885,84 @@ rate_limiter_status_t rate_limiter_change_rate(p_rate_limiter_t rl_inst, const f
 	{
 		if ( true == rl_inst->is_init )
 		{
-			rl_inst->k_rise = rate_limiter_calc_rate_factor( rl_inst->dt, rise_rate );
-			rl_inst->k_fall = rate_limiter_calc_rate_factor( rl_inst->dt, fall_rate );
+			rate_limiter_set_rate( rl_inst, rise_rate, fall_rate );
+			rate_limiter_set_k( rl_inst, rate_limiter_calc_rate_factor( rl_inst->dt, rise_rate ), rate_limiter_calc_rate_factor( rl_inst->dt, fall_rate ));
+
+			status = eRATE_LIMITER_OK;
+		}
+	}
+
+	return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/*!
+* @brief    Take snapshot of rate limiter state
+*
+* @note Snapshot holds complete state, so that restored instance continues
+* 		exactly where it stopped. Shall not run concurrently with update.
+*
+* @param[in]  	rl_inst		- Pointer to rate limiter instance
+* @param[out]  	p_snap		- Pointer to snapshot
+* @return       status		- Either OK or Error
+*/
+////////////////////////////////////////////////////////////////////////////////
+rate_limiter_status_t rate_limiter_snapshot(p_rate_limiter_t rl_inst, rate_limiter_snapshot_t * const p_snap)
+{
+	rate_limiter_status_t status = eRATE_LIMITER_ERROR;
+
+	// Check for instance, initialization and snapshot
+	if 	(	( NULL != rl_inst )
+		&&	( NULL != p_snap ))
+	{
+		if ( true == rl_inst->is_init )
+		{
+			rate_limiter_snapshot_set_header( &p_snap->header, eRATE_LIMITER_SNAPSHOT_INSTANCE, 1U, 1U, sizeof( rate_limiter_snapshot_t ), rl_inst->dt );
+
+			p_snap->x_prev = rl_inst->x_prev;
+			rate_limiter_get_k( rl_inst, &p_snap->k_rise, &p_snap->k_fall );
+			rate_limiter_get_rate( rl_inst, &p_snap->rise_rate, &p_snap->fall_rate );
+
+			p_snap->reserved[0] = 0U;
+			p_snap->reserved[1] = 0U;
+			p_snap->reserved[2] = 0U;
+
+			status = eRATE_LIMITER_OK;
+		}
+	}
+
+	return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/*!
+* @brief    Restore rate limiter state from snapshot
+*
+* @note Instance shall be initialized. Period, slew rates and previous
+* 		output are taken from snapshot. On invalid snapshot instance is
+* 		left untouched. Shall not run concurrently with update.
+*
+* @param[in]  	rl_inst		- Pointer to rate limiter instance
+* @param[in]  	p_snap		- Pointer to snapshot
+* @return       status		- Either OK or Error
+*/
+////////////////////////////////////////////////////////////////////////////////
+rate_limiter_status_t rate_limiter_restore(p_rate_limiter_t rl_inst, const rate_limiter_snapshot_t * const p_snap)
+{
+	rate_limiter_status_t status = eRATE_LIMITER_ERROR;
+
+	// Check for instance, initialization and snapshot
+	if 	(	( NULL != rl_inst )
+		&&	( NULL != p_snap ))
+	{
+		if 	(	( true == rl_inst->is_init )
+			&&	( true == rate_limiter_snapshot_check_header( &p_snap->header, eRATE_LIMITER_SNAPSHOT_INSTANCE, 1U, sizeof( rate_limiter_snapshot_t ))))
+		{
+			rl_inst->x_prev = p_snap->x_prev;
+			rl_inst->dt = p_snap->header.dt;
+
+			rate_limiter_set_rate( rl_inst, p_snap->rise_rate, p_snap->fall_rate );
+			rate_limiter_set_k( rl_inst, p_snap->k_rise, p_snap->k_fall );
 
 			status = eRATE_LIMITER_OK;
 		}
@@ -267,6 +971,166 @@ rate_limiter_status_t rate_limiter_change_rate(p_rate_limiter_t rl_inst, const f
 	return status;
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/*!
+* @brief    Initialize compact rate limiter
+*
+* @note Instance memory is provided by user. Slew rate units are the same
+* 		as with "rate_limiter_init()".
+*
+* @param[out]  	p_inst		- Pointer to compact rate limiter instance
+* @param[in]  	rise_rate	- Rising slew rate
+* @param[in]  	fall_rate	- Falling slew rate
+* @param[in]  	dt			- Update (period) time
+* @return       status		- Either OK or Error
+*/
+////////////////////////////////////////////////////////////////////////////////
+rate_limiter_status_t rate_limiter_compact_init(rate_limiter_compact_t * const p_inst, const float32_t rise_rate, const float32_t fall_rate, const float32_t dt)
+{
+	rate_limiter_status_t status = eRATE_LIMITER_OK;
+
+	if 	(	( NULL != p_inst )
+		&& 	( dt > 0.0f ))
+	{
+		p_inst->x_prev = 0.0f;
+		p_inst->k_rise = rate_limiter_calc_rate_factor( dt, rise_rate );
+		p_inst->k_fall = rate_limiter_calc_rate_factor( dt, fall_rate );
+
+		// Init success
+		p_inst->init = RATE_LIMITER_COMPACT_INIT_MAGIC;
+	}
+	else
+	{
+		status = eRATE_LIMITER_ERROR;
+	}
+
+	return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/*!
+* @brief    Update compact rate limiter
+*
+* @note Same behaviour as "rate_limiter_update()".
+*
+* @param[in]  	p_inst		- Pointer to compact rate limiter instance
+* @param[in]  	x			- Input signal
+* @return       y			- Output (slew limited) signal
+*/
+////////////////////////////////////////////////////////////////////////////////
+float32_t rate_limiter_compact_update(rate_limiter_compact_t * const p_inst, const float32_t x)
+{
+	float32_t y = 0.0f;
+
+	// Check for instance and initialization
+	if ( NULL != p_inst )
+	{
+		if ( RATE_LIMITER_COMPACT_INIT_MAGIC == p_inst->init )
+		{
+			y = rate_limiter_limit( x, p_inst->x_prev, p_inst->k_rise, p_inst->k_fall );
+
+			// Store current value
+			p_inst->x_prev = y;
+		}
+	}
+
+	return y;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/*!
+* @brief    Update compact rate limiter over block of samples
+*
+* @note Same behaviour as "rate_limiter_update_block()".
+*
+* @param[in]  	p_inst		- Pointer to compact rate limiter instance
+* @param[in]  	p_x			- Pointer to input signal samples
+* @param[out]  	p_y			- Pointer to output (slew limited) signal samples
+* @param[in]  	size		- Number of samples in block
+* @return       status		- Either OK or Error
+*/
+////////////////////////////////////////////////////////////////////////////////
+rate_limiter_status_t rate_limiter_compact_update_block(rate_limiter_compact_t * const p_inst, const float32_t * const p_x, float32_t * const p_y, const size_t size)
+{
+	rate_limiter_status_t 	status 	= eRATE_LIMITER_ERROR;
+	float32_t				x_prev	= 0.0f;
+	size_t					i		= 0;
+
+	// Check for instance, initialization and buffers
+	if 	(	( NULL != p_inst )
+		&&	( NULL != p_x )
+		&&	( NULL != p_y ))
+	{
+		if ( RATE_LIMITER_COMPACT_INIT_MAGIC == p_inst->init )
+		{
+			x_prev = p_inst->x_prev;
+
+			for ( i = 0; i < size; i++ )
+			{
+				x_prev = rate_limiter_limit( p_x[i], x_prev, p_inst->k_rise, p_inst->k_fall );
+				p_y[i] = x_prev;
+			}
+
+			p_inst->x_prev = x_prev;
+
+			status = eRATE_LIMITER_OK;
+		}
+	}
+
+	return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/*!
+* @brief    Get success initialization flag of compact rate limiter
+*
+* @param[in]  	p_inst		- Pointer to compact rate limiter instance
+* @return       is_init		- Success initialization flag
+*/
+////////////////////////////////////////////////////////////////////////////////
+bool rate_limiter_compact_is_init(const rate_limiter_compact_t * const p_inst)
+{
+	bool is_init = false;
+
+	if ( NULL != p_inst )
+	{
+		is_init = ( RATE_LIMITER_COMPACT_INIT_MAGIC == p_inst->init );
+	}
+
+	return is_init;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/*!
+* @brief    Change slew rate of compact rate limiter
+*
+* @note As update period is not stored in compact instance, it must be
+* 		given again.
+*
+* @param[in]  	p_inst		- Pointer to compact rate limiter instance
+* @param[in]  	rise_rate	- Rising slew rate
+* @param[in]  	fall_rate	- Falling slew rate
+* @param[in]  	dt			- Update (period) time
+* @return       status		- Either OK or Error
+*/
+////////////////////////////////////////////////////////////////////////////////
+rate_limiter_status_t rate_limiter_compact_change_rate(rate_limiter_compact_t * const p_inst, const float32_t rise_rate, const float32_t fall_rate, const float32_t dt)
+{
+	rate_limiter_status_t status = eRATE_LIMITER_ERROR;
+
+	// Check for instance and initialization
+	if 	(	( true == rate_limiter_compact_is_init( p_inst ))
+		&&	( dt > 0.0f ))
+	{
+		p_inst->k_rise = rate_limiter_calc_rate_factor( dt, rise_rate );
+		p_inst->k_fall = rate_limiter_calc_rate_factor( dt, fall_rate );
+
+		status = eRATE_LIMITER_OK;
+	}
+
+	return status;
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /**
 * @} <!-- END GROUP -->
@@ -7,7 +7,7 @@
 *@brief     Rate limiter for general use
 *@author    Ziga Miklosic
 *@date      19.02.2021
-*@version   V1.0.1
+*@version   V1.1.0
 */
 ////////////////////////////////////////////////////////////////////////////////
 /**
@@ -37,8 +37,54 @@
  * 	Module version
  */
 #define RATE_LIMITER_VER_MAJOR			( 1 )
-#define RATE_LIMITER_VER_MINOR			( 0 )
-#define RATE_LIMITER_VER_DEVELOP		( 1 )
+#define RATE_LIMITER_VER_MINOR			( 1 )
+#define RATE_LIMITER_VER_DEVELOP		( 0 )
+
+/**
+ * 	Branchless update
+ *
+ * @note When enabled rate limiter is computed in compare & select form
+ * 		without any branches, thus cost of update is independent of
+ * 		input signal. Results are bit exact in both forms. Can be
+ * 		overridden in "project_config.h".
+ *
+ * 	0 - Disabled
+ * 	1 - Enabled
+ */
+#ifndef RATE_LIMITER_BRANCHLESS_EN
+	#define RATE_LIMITER_BRANCHLESS_EN		( 0 )
+#endif
+
+/**
+ * 	Size of static instance pool
+ *
+ * @note When larger than zero, "rate_limiter_init()" acquires instances
+ * 		from statically allocated pool of that size instead of heap.
+ * 		Acquire and release are O(1). Pool is not thread safe. Can be
+ * 		overridden in "project_config.h".
+ *
+ * 	0 - Pool disabled, instances are allocated on heap
+ */
+#ifndef RATE_LIMITER_POOL_SIZE
+	#define RATE_LIMITER_POOL_SIZE			( 0U )
+#endif
+
+/**
+ * 	Lock-free slew rate change
+ *
+ * @note When enabled, rising/falling slew rate factors of instance are
+ * 		kept packed in single 64-bit C11 atomic, so that
+ * 		"rate_limiter_change_rate()" from another thread is never seen
+ * 		torn by update functions, while update stays wait-free. Requires
+ * 		C11 compiler with lock-free 64-bit atomics. Can be overridden in
+ * 		"project_config.h".
+ *
+ * 	0 - Disabled
+ * 	1 - Enabled
+ */
+#ifndef RATE_LIMITER_ATOMIC_EN
+	#define RATE_LIMITER_ATOMIC_EN			( 0 )
+#endif
 
 /**
  * 	Status
@@ -49,18 +95,149 @@ typedef enum
 	eRATE_LIMITER_ERROR,	/**<General error */
 } rate_limiter_status_t;
 
+/**
+ * 	Target is never reached
+ *
+ * @note Returned by "rate_limiter_steps_to_target()".
+ */
+#define RATE_LIMITER_STEPS_INF			( UINT32_MAX )
+
 /**
  * 	Pointer to slew rate limiter instance
  */
 typedef struct rate_limiter_s * p_rate_limiter_t;
 
+/**
+ * 	Size of rate limiter instance in bytes
+ *
+ * @note For use with "rate_limiter_init_in_place()".
+ */
+#if ( 1 == RATE_LIMITER_ATOMIC_EN )
+	#define RATE_LIMITER_STORAGE_SIZE		( 32U )
+#else
+	#define RATE_LIMITER_STORAGE_SIZE		( 28U )
+#endif
+
+/**
+ * 	Rate limiter instance storage
+ *
+ * @note Content is private to rate limiter module. Storage can be placed
+ * 		in static memory, on stack or inside user object and passed to
+ * 		"rate_limiter_init_in_place()".
+ */
+typedef union
+{
+	uint8_t		mem[RATE_LIMITER_STORAGE_SIZE];	/**<Instance memory */
+	float32_t	align;							/**<Alignment of instance */
+#if ( 1 == RATE_LIMITER_ATOMIC_EN )
+	uint64_t	align_atomic;					/**<Alignment of atomic slew rate factors */
+#endif
+} rate_limiter_storage_t;
+
+/**
+ * 	Alignment attribute
+ */
+#if defined( __GNUC__ )
+	#define RATE_LIMITER_ALIGNED(n)		__attribute__(( aligned( n )))
+#else
+	#define RATE_LIMITER_ALIGNED(n)
+#endif
+
+/**
+ * 	Compact slew rate limiter
+ *
+ * @note Holds only state needed by update, 16 bytes large and aligned,
+ * 		so that four instances fit into single 64 byte cache line.
+ * 		Update period is not stored, thus it must be given again when
+ * 		changing slew rate. Instance is owned by user and fields shall
+ * 		only be accessed by "rate_limiter_compact_" functions.
+ */
+typedef struct
+{
+	float32_t	x_prev;		/**<Previous value of input */
+	float32_t	k_rise;		/**<Rising slew rate factor */
+	float32_t	k_fall;		/**<Falling slew rate factor */
+	uint32_t	init;		/**<Initialization sentinel */
+} RATE_LIMITER_ALIGNED( 16 ) rate_limiter_compact_t;
+
+/**
+ * 	Snapshot magic ("RLSN"), read swapped on other byte order
+ */
+#define RATE_LIMITER_SNAPSHOT_MAGIC		( 0x524C534EUL )
+
+/**
+ * 	Snapshot format version
+ *
+ * @note Incremented on any change of snapshot layout.
+ */
+#define RATE_LIMITER_SNAPSHOT_VERSION	( 1U )
+
+/**
+ * 	Snapshot type
+ */
+typedef enum
+{
+	eRATE_LIMITER_SNAPSHOT_INSTANCE = 1,	/**<Single rate limiter instance */
+	eRATE_LIMITER_SNAPSHOT_BANK,			/**<Rate limiter bank */
+} rate_limiter_snapshot_type_t;
+
+/**
+ * 	Snapshot header
+ *
+ * @note Fixed 64 byte layout in native byte order and IEEE-754 floats,
+ * 		shared by all snapshot types. Channel arrays of bank snapshot
+ * 		follow header, each "stride" channels long.
+ */
+typedef struct
+{
+	uint32_t	magic;			/**<RATE_LIMITER_SNAPSHOT_MAGIC */
+	uint16_t	version;		/**<RATE_LIMITER_SNAPSHOT_VERSION */
+	uint16_t	type;			/**<Snapshot type, see rate_limiter_snapshot_type_t */
+	uint32_t	num_of_ch;		/**<Number of channels */
+	uint32_t	stride;			/**<Length of channel arrays */
+	uint64_t	size;			/**<Snapshot size in bytes, header included */
+	float32_t	dt;				/**<Period of update */
+	uint32_t	reserved[9];	/**<Reserved, zero */
+} rate_limiter_snapshot_header_t;
+
+/**
+ * 	Rate limiter instance snapshot
+ *
+ * @note Fixed layout, can be written and read with single memcpy or write().
+ */
+typedef struct
+{
+	rate_limiter_snapshot_header_t	header;			/**<Snapshot header */
+	float32_t						x_prev;			/**<Previous value of input */
+	float32_t						k_rise;			/**<Rising slew rate factor */
+	float32_t						k_fall;			/**<Falling slew rate factor */
+	float32_t						rise_rate;		/**<Rising slew rate */
+	float32_t						fall_rate;		/**<Falling slew rate */
+	uint32_t						reserved[3];	/**<Reserved, zero */
+} rate_limiter_snapshot_t;
+
 ////////////////////////////////////////////////////////////////////////////////
 // Functions
 ////////////////////////////////////////////////////////////////////////////////
 rate_limiter_status_t 	rate_limiter_init			(p_rate_limiter_t * p_rl_inst, const float32_t rise_rate, const float32_t fall_rate, const float32_t dt);
+rate_limiter_status_t 	rate_limiter_init_in_place	(p_rate_limiter_t * p_rl_inst, void * const p_mem, const float32_t rise_rate, const float32_t fall_rate, const float32_t dt);
+rate_limiter_status_t 	rate_limiter_deinit			(p_rate_limiter_t * p_rl_inst);
 float32_t				rate_limiter_update			(p_rate_limiter_t rl_inst, const float32_t x);
+float32_t				rate_limiter_update_dt		(p_rate_limiter_t rl_inst, const float32_t x, const float32_t dt);
+rate_limiter_status_t	rate_limiter_update_block	(p_rate_limiter_t rl_inst, const float32_t * const p_x, float32_t * const p_y, const size_t size);
+float32_t				rate_limiter_advance		(p_rate_limiter_t rl_inst, const float32_t x, const uint32_t n_steps);
+uint32_t				rate_limiter_steps_to_target(p_rate_limiter_t rl_inst, const float32_t x);
+float32_t				rate_limiter_output_at		(p_rate_limiter_t rl_inst, const float32_t x, const uint32_t n_steps);
 bool					rate_limiter_is_init		(p_rate_limiter_t rl_inst);
 rate_limiter_status_t	rate_limiter_change_rate	(p_rate_limiter_t rl_inst, const float32_t rise_rate, const float32_t fall_rate);
+rate_limiter_status_t	rate_limiter_snapshot		(p_rate_limiter_t rl_inst, rate_limiter_snapshot_t * const p_snap);
+rate_limiter_status_t	rate_limiter_restore		(p_rate_limiter_t rl_inst, const rate_limiter_snapshot_t * const p_snap);
+
+rate_limiter_status_t	rate_limiter_compact_init		(rate_limiter_compact_t * const p_inst, const float32_t rise_rate, const float32_t fall_rate, const float32_t dt);
+float32_t				rate_limiter_compact_update		(rate_limiter_compact_t * const p_inst, const float32_t x);
+rate_limiter_status_t	rate_limiter_compact_update_block(rate_limiter_compact_t * const p_inst, const float32_t * const p_x, float32_t * const p_y, const size_t size);
+bool					rate_limiter_compact_is_init	(const rate_limiter_compact_t * const p_inst);
+rate_limiter_status_t	rate_limiter_compact_change_rate(rate_limiter_compact_t * const p_inst, const float32_t rise_rate, const float32_t fall_rate, const float32_t dt);
 
 #endif // __RATE_LIMITER_H
 
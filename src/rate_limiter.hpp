@@ -0,0 +1,227 @@
+// Copyright (c) 2021 Ziga Miklosic
+// All Rights Reserved
+// This software is under MIT licence (https://opensource.org/licenses/MIT)
+////////////////////////////////////////////////////////////////////////////////
+/**
+*@file      rate_limiter.hpp
+*@brief     Header only C++ rate limiter with compile time configuration
+*@author    Ziga Miklosic
+*@date      19.02.2021
+*@version   V1.1.0
+*
+*@section Description
+*
+*	For rate limiters where rise rate, fall rate and update period are
+*	known at build time. Slew rate factors are computed as constexpr, so
+*	update is fully inlined and needs no factor loads.
+*
+*	As C++17 does not allow floating point template parameters, rates and
+*	period are given as std::ratio types, e.g. std::ratio<1, 100> for
+*	0.01. Factors are computed in T as ( num / den ) of rate times
+*	( num / den ) of period, same as "rate_limiter_calc_rate_factor()",
+*	thus results are bit exact to C rate limiter with the same parameters.
+*
+*	Object holds only previous output value, so it is no larger than T
+*	and arrays of it are as dense as arrays of samples. It is not layout
+*	compatible with any C rate limiter type ("rate_limiter_compact_t"
+*	holds slew rate factors as well), state is exchanged with C code as
+*	value with "get()" and constructor.
+*
+*@section Code_example
+*@code
+*
+*	// Rise 1.0 unit/s, fall 0.5 unit/s, dt = 10 ms
+*	static rate_limiter<float, std::ratio<1>, std::ratio<1, 2>, std::ratio<1, 100>> my_rl;
+*
+*	@period_time
+*	{
+*		y = my_rl.update( x );
+*	}
+*
+*@endcode
+*
+*/
+////////////////////////////////////////////////////////////////////////////////
+/**
+*@addtogroup RATE_LIMITER_CPP_API
+* @{ <!-- BEGIN GROUP -->
+*
+*/
+////////////////////////////////////////////////////////////////////////////////
+
+#ifndef __RATE_LIMITER_HPP
+#define __RATE_LIMITER_HPP
+
+////////////////////////////////////////////////////////////////////////////////
+// Includes
+////////////////////////////////////////////////////////////////////////////////
+#include <cstddef>
+#include <cstdint>
+#include <ratio>
+#include <type_traits>
+
+////////////////////////////////////////////////////////////////////////////////
+// Definitions
+////////////////////////////////////////////////////////////////////////////////
+
+/**
+ * 	Compile time configured slew rate limiter
+ *
+ * @param	T		- Floating point sample type
+ * @param	Rise	- Rising slew rate as std::ratio
+ * @param	Fall	- Falling slew rate as std::ratio
+ * @param	Dt		- Update (period) time as std::ratio
+ */
+template<typename T, typename Rise, typename Fall, typename Dt>
+class rate_limiter
+{
+	static_assert( std::is_floating_point<T>::value, "Rate limiter sample type must be floating point" );
+	static_assert(( Dt::num > 0 ) && ( Dt::den > 0 ), "Rate limiter update time must be positive" );
+
+	public:
+
+		/**
+		 * 	Slew rate factors
+		 */
+		static constexpr T k_rise = (( static_cast<T>( Rise::num ) / static_cast<T>( Rise::den )) * ( static_cast<T>( Dt::num ) / static_cast<T>( Dt::den )));
+		static constexpr T k_fall = (( static_cast<T>( Fall::num ) / static_cast<T>( Fall::den )) * ( static_cast<T>( Dt::num ) / static_cast<T>( Dt::den )));
+
+		////////////////////////////////////////////////////////////////////////////////
+		/*!
+		* @brief    Construct rate limiter
+		*
+		* @param[in]  	x_init		- Initial output value
+		*/
+		////////////////////////////////////////////////////////////////////////////////
+		constexpr explicit rate_limiter(const T x_init = static_cast<T>( 0 )) noexcept
+			: x_prev( x_init )
+		{
+			// Holds previous output only
+			static_assert(( std::is_standard_layout<rate_limiter>::value ) && ( sizeof( rate_limiter ) == sizeof( T )), "Rate limiter layout must be plain T" );
+		}
+
+		////////////////////////////////////////////////////////////////////////////////
+		/*!
+		* @brief    Update rate limiter
+		*
+		* @param[in]  	x			- Input signal
+		* @return       y			- Output (slew limited) signal
+		*/
+		////////////////////////////////////////////////////////////////////////////////
+		constexpr T update(const T x) noexcept
+		{
+			x_prev = limit( x, x_prev, k_rise, k_fall );
+
+			return x_prev;
+		}
+
+		////////////////////////////////////////////////////////////////////////////////
+		/*!
+		* @brief    Update rate limiter over block of samples
+		*
+		* @note Input and output buffer may point to the same location.
+		*
+		* @param[in]  	p_x			- Pointer to input signal samples
+		* @param[out]  	p_y			- Pointer to output (slew limited) signal samples
+		* @param[in]  	size		- Number of samples in block
+		* @return       void
+		*/
+		////////////////////////////////////////////////////////////////////////////////
+		constexpr void update_block(const T * const p_x, T * const p_y, const std::size_t size) noexcept
+		{
+			T y = x_prev;
+
+			for ( std::size_t i = 0; i < size; i++ )
+			{
+				y = limit( p_x[i], y, k_rise, k_fall );
+				p_y[i] = y;
+			}
+
+			x_prev = y;
+		}
+
+		////////////////////////////////////////////////////////////////////////////////
+		/*!
+		* @brief    Advance rate limiter by multiple steps of constant input
+		*
+		* @note Same as "rate_limiter_advance()". For n_steps = 1 result is
+		* 		bit exact to single update.
+		*
+		* @param[in]  	x			- Input signal, constant over all steps
+		* @param[in]  	n_steps		- Number of steps
+		* @return       y			- Output (slew limited) signal after n_steps
+		*/
+		////////////////////////////////////////////////////////////////////////////////
+		constexpr T advance(const T x, const std::uint32_t n_steps) noexcept
+		{
+			const T n = static_cast<T>( n_steps );
+
+			x_prev = limit( x, x_prev, ( n * k_rise ), ( n * k_fall ));
+
+			return x_prev;
+		}
+
+		////////////////////////////////////////////////////////////////////////////////
+		/*!
+		* @brief    Get current output value
+		*
+		* @return       y			- Previous output (slew limited) signal
+		*/
+		////////////////////////////////////////////////////////////////////////////////
+		constexpr T get(void) const noexcept
+		{
+			return x_prev;
+		}
+
+	private:
+
+		////////////////////////////////////////////////////////////////////////////////
+		/*!
+		* @brief    Slew limit input signal against previous output
+		*
+		* @note Same comparison order as "rate_limiter_limit()", rising
+		* 		limit has precedence.
+		*
+		* @param[in]  	x			- Input signal
+		* @param[in]  	x_prev		- Previous output signal
+		* @param[in]  	k_rise		- Rising slew rate factor
+		* @param[in]  	k_fall		- Falling slew rate factor
+		* @return       y			- Output (slew limited) signal
+		*/
+		////////////////////////////////////////////////////////////////////////////////
+		static constexpr T limit(const T x, const T x_prev, const T k_rise, const T k_fall) noexcept
+		{
+			const T dx = x - x_prev;
+			T		y  = x;
+
+			// Rising limit
+			if ( dx >= k_rise )
+			{
+				y = x_prev + k_rise;
+			}
+
+			// Falling limit
+			else if ( dx <= -( k_fall ))
+			{
+				y = x_prev - k_fall;
+			}
+
+			// No limitations...
+			else
+			{
+				y = x;
+			}
+
+			return y;
+		}
+
+		T	x_prev;		/**<Previous value of input */
+};
+
+#endif // __RATE_LIMITER_HPP
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+* @} <!-- END GROUP -->
+*/
+////////////////////////////////////////////////////////////////////////////////
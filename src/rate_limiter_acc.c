@@ -0,0 +1,655 @@
+// Copyright (c) 2021 Ziga Miklosic
+// All Rights Reserved
+// This software is under MIT licence (https://opensource.org/licenses/MIT)
+////////////////////////////////////////////////////////////////////////////////
+/**
+*@file      rate_limiter_acc.c
+*@brief     Second order (rate and acceleration) limiter
+*@author    Ziga Miklosic
+*@date      19.02.2021
+*@version   V1.1.0
+*
+*@section Description
+*
+*	Second order limiter follows input signal with limited rate (rise and
+*	fall slew rate as with rate limiter) and limited acceleration. Instead
+*	of cascading two rate limiters, position and its change per period are
+*	kept as state and both limits are applied in single update.
+*
+*	Each update wanted change is the largest one from which output can
+*	still stop at input with given acceleration:
+*
+*		v = a * ( sqrt( 1 + 8|e|/a ) - 1 ) / 2,	v <= |e|
+*
+*	where e is distance to input and a acceleration factor (acc * dt^2).
+*	It is limited by rise/fall slew rate factor and then to previous change
+*	+/- a. Resulting profile is trapezoidal: accelerate, cruise at slew
+*	rate and brake to reach input without overshoot.
+*
+*	Rounding error of braking law grows with each step of braking, so it is
+*	planned with acceleration scaled by RATE_LIMITER_ACC_MARGIN, leaving
+*	spare acceleration to catch up with it. Output position is accumulated
+*	with compensation term (as S-curve limiter does), so that braking law
+*	sees true distance to input even when acceleration factor is far below
+*	float resolution of output.
+*
+*	Once remaining distance, change and their difference are all within
+*	acceleration factor plus input resolution, output lands exactly on
+*	constant input and change is cleared, so braking can not stall one
+*	ulp off the input and landing step still respects acceleration limit.
+*
+*	Update is branchless, so bank kernel is vectorized by compiler once
+*	errno handling of sqrtf() is disabled (GCC/Clang -fno-math-errno).
+*	Square root argument is never negative, so results do not change.
+*
+*/
+////////////////////////////////////////////////////////////////////////////////
+/*!
+* @addtogroup RATE_LIMITER_ACC
+* @{ <!-- BEGIN GROUP -->
+*/
+////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////
+// Includes
+////////////////////////////////////////////////////////////////////////////////
+#include "rate_limiter_acc.h"
+#include "rate_limiter_bank.h"
+#include "rate_limiter_kernel.h"
+
+#include <math.h>
+#include <float.h>
+
+////////////////////////////////////////////////////////////////////////////////
+// Definitions
+////////////////////////////////////////////////////////////////////////////////
+
+/**
+ * 	Initialization sentinel
+ */
+#define RATE_LIMITER_ACC_INIT_MAGIC			( 0x52414343UL )
+
+/**
+ * 	Scale of acceleration used for planning of braking
+ */
+#define RATE_LIMITER_ACC_MARGIN				( 0.8f )
+
+/**
+ * 	Number of channels per aligned array block
+ */
+#define RATE_LIMITER_ACC_CH_PER_ALIGN		( RATE_LIMITER_BANK_ALIGN / sizeof( float32_t ))
+
+/**
+ * 	Second order rate limiter bank
+ */
+typedef struct rate_limiter_acc_bank_s
+{
+	float32_t *	p_x_prev;	/**<Previous outputs of channels */
+	float32_t *	p_x_res;	/**<Rounding compensations of channels */
+	float32_t *	p_v_prev;	/**<Previous output changes of channels */
+	float32_t *	p_k_rise;	/**<Rising slew rate factors of channels */
+	float32_t * p_k_fall;	/**<Falling slew rate factors of channels */
+	float32_t * p_k_acc;	/**<Acceleration factors of channels */
+	void *		p_mem;		/**<Allocated memory space of channel arrays */
+	float32_t 	dt;			/**<Period of update */
+	uint32_t	num_of_ch;	/**<Number of channels */
+	bool		is_init;	/**<Rate limiter bank initialization success flag */
+} rate_limiter_acc_bank_t;
+
+////////////////////////////////////////////////////////////////////////////////
+// Variables
+////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////
+// Function prototypes
+////////////////////////////////////////////////////////////////////////////////
+static inline float32_t	rate_limiter_acc_limit		(const float32_t x, float32_t * const p_x_prev, float32_t * const p_x_res, float32_t * const p_v_prev, const float32_t k_rise, const float32_t k_fall, const float32_t k_acc);
+static void				rate_limiter_acc_bank_kernel(const float32_t * const p_x, float32_t * const p_y, float32_t * restrict p_x_prev, float32_t * restrict p_x_res, float32_t * restrict p_v_prev, const float32_t * restrict p_k_rise, const float32_t * restrict p_k_fall, const float32_t * restrict p_k_acc, const uint32_t num_of_ch);
+static bool				rate_limiter_acc_check_rate	(const float32_t rise_rate, const float32_t fall_rate, const float32_t acc);
+
+////////////////////////////////////////////////////////////////////////////////
+// Functions
+////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////
+/*!
+* @brief    Rate and acceleration limit input signal
+*
+* @note Shared between single sample, block and bank update, so all of
+* 		them give bit exact results. Limits are applied with select, thus
+* 		without any control flow.
+*
+* 		Acceleration limit is applied last, so after lowering slew rate
+* 		output brakes down to new rate instead of jumping.
+*
+* @param[in]  	x			- Input signal
+* @param[in,out]  	p_x_prev	- Previous output
+* @param[in,out]  	p_x_res		- Rounding compensation of output
+* @param[in,out]  	p_v_prev	- Previous output change
+* @param[in]  	k_rise		- Rising slew rate factor
+* @param[in]  	k_fall		- Falling slew rate factor
+* @param[in]  	k_acc		- Acceleration factor
+* @return       y			- Output (rate and acceleration limited) signal
+*/
+////////////////////////////////////////////////////////////////////////////////
+static inline float32_t rate_limiter_acc_limit(const float32_t x, float32_t * const p_x_prev, float32_t * const p_x_res, float32_t * const p_v_prev, const float32_t k_rise, const float32_t k_fall, const float32_t k_acc)
+{
+	const float32_t x_prev	= *p_x_prev;
+	const float32_t e 		= (( x - x_prev ) - *p_x_res );
+	const float32_t e_abs 	= fabsf( e );
+	const float32_t v_prev	= *p_v_prev;
+	const float32_t v_hi 	= v_prev + k_acc;
+	const float32_t v_lo 	= v_prev - k_acc;
+	const float32_t eps		= ( k_acc + ( FLT_EPSILON * fabsf( x )));
+	const float32_t k_brake	= ( RATE_LIMITER_ACC_MARGIN * k_acc );
+	float32_t		v		= 0.0f;
+	float32_t		v_sum	= 0.0f;
+	float32_t		y		= 0.0f;
+	bool			is_land	= false;
+	bool			is_at	= false;
+
+	// Fastest change from which output still stops at input
+	v = ( 0.5f * k_brake * ( sqrtf( 1.0f + (( 8.0f * e_abs ) / k_brake )) - 1.0f ));
+	v = rate_limiter_select(( v > e_abs ), e_abs, v );
+	v = rate_limiter_select(( e < 0.0f ), -v, v );
+
+	// Slew rate limit
+	v = rate_limiter_select(( v > k_rise ), k_rise, v );
+	v = rate_limiter_select(( v < -( k_fall )), -( k_fall ), v );
+
+	// Acceleration limit
+	v = rate_limiter_select(( v > v_hi ), v_hi, v );
+	v = rate_limiter_select(( v < v_lo ), v_lo, v );
+
+	// Compensated position sum
+	v_sum = ( v + *p_x_res );
+	y = ( x_prev + v_sum );
+
+	// Land on input once rest of move is below resolution (no short circuit, kept branchless)
+	is_land = 	(	( e_abs <= eps )
+				&	( fabsf( v_prev ) <= eps )
+				&	( fabsf( e - v_prev ) <= eps ));
+
+	// Land exactly on input when reached
+	is_at = ( is_land | ( v == e ));
+
+	*p_x_res = rate_limiter_select( is_at, 0.0f, ( v_sum - ( y - x_prev )));
+	*p_v_prev = rate_limiter_select( is_land, 0.0f, v );
+	*p_x_prev = rate_limiter_select( is_at, x, y );
+
+	return *p_x_prev;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/*!
+* @brief    Update all channels of second order bank
+*
+* @note State arrays are restrict parameters and are accessed through
+* 		locals, so only input and output buffer need run-time alias check
+* 		and compiler can vectorize loop.
+*
+* @param[in]  	p_x			- Pointer to input signals
+* @param[out]  	p_y			- Pointer to output (limited) signals
+* @param[in]  	p_x_prev	- Pointer to previous outputs
+* @param[in]  	p_x_res		- Pointer to rounding compensations
+* @param[in]  	p_v_prev	- Pointer to previous output changes
+* @param[in]  	p_k_rise	- Pointer to rising slew rate factors
+* @param[in]  	p_k_fall	- Pointer to falling slew rate factors
+* @param[in]  	p_k_acc		- Pointer to acceleration factors
+* @param[in]  	num_of_ch	- Number of channels
+* @return       void
+*/
+////////////////////////////////////////////////////////////////////////////////
+static void rate_limiter_acc_bank_kernel(const float32_t * const p_x, float32_t * const p_y, float32_t * restrict p_x_prev, float32_t * restrict p_x_res, float32_t * restrict p_v_prev, const float32_t * restrict p_k_rise, const float32_t * restrict p_k_fall, const float32_t * restrict p_k_acc, const uint32_t num_of_ch)
+{
+	float32_t 	x_prev	= 0.0f;
+	float32_t 	x_res	= 0.0f;
+	float32_t 	v_prev	= 0.0f;
+	uint32_t	ch		= 0;
+
+	for ( ch = 0; ch < num_of_ch; ch++ )
+	{
+		x_prev = p_x_prev[ch];
+		x_res = p_x_res[ch];
+		v_prev = p_v_prev[ch];
+
+		p_y[ch] = rate_limiter_acc_limit( p_x[ch], &x_prev, &x_res, &v_prev, p_k_rise[ch], p_k_fall[ch], p_k_acc[ch] );
+
+		p_x_prev[ch] = x_prev;
+		p_x_res[ch] = x_res;
+		p_v_prev[ch] = v_prev;
+	}
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/*!
+* @brief    Check second order limiter rates
+*
+* @note Acceleration shall be positive as brake change is divided by it.
+*
+* @param[in]  	rise_rate	- Rising slew rate
+* @param[in]  	fall_rate	- Falling slew rate
+* @param[in]  	acc			- Acceleration limit
+* @return       valid		- True when rates are valid
+*/
+////////////////////////////////////////////////////////////////////////////////
+static bool rate_limiter_acc_check_rate(const float32_t rise_rate, const float32_t fall_rate, const float32_t acc)
+{
+	return 	(	( rise_rate >= 0.0f )
+			&&	( fall_rate >= 0.0f )
+			&&	( acc > 0.0f ));
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+* @} <!-- END GROUP -->
+*/
+////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*@addtogroup RATE_LIMITER_ACC_API
+* @{ <!-- BEGIN GROUP -->
+*
+* 	Following function are part or second order rate limiter API.
+*/
+////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////
+/*!
+* @brief    Initialize second order rate limiter
+*
+* @note Instance memory is provided by user. Slew rate units are the same
+* 		as with "rate_limiter_init()", acceleration is in unit/sec^2.
+*
+* @param[out]  	p_inst		- Pointer to second order rate limiter instance
+* @param[in]  	rise_rate	- Rising slew rate
+* @param[in]  	fall_rate	- Falling slew rate
+* @param[in]  	acc			- Acceleration limit
+* @param[in]  	dt			- Update (period) time
+* @return       status		- Either OK or Error
+*/
+////////////////////////////////////////////////////////////////////////////////
+rate_limiter_status_t rate_limiter_acc_init(rate_limiter_acc_t * const p_inst, const float32_t rise_rate, const float32_t fall_rate, const float32_t acc, const float32_t dt)
+{
+	rate_limiter_status_t status = eRATE_LIMITER_OK;
+
+	if 	(	( NULL != p_inst )
+		&& 	( dt > 0.0f )
+		&&	( true == rate_limiter_acc_check_rate( rise_rate, fall_rate, acc )))
+	{
+		p_inst->x_prev = 0.0f;
+		p_inst->x_res = 0.0f;
+		p_inst->v_prev = 0.0f;
+		p_inst->dt = dt;
+		p_inst->k_rise = rate_limiter_calc_rate_factor( dt, rise_rate );
+		p_inst->k_fall = rate_limiter_calc_rate_factor( dt, fall_rate );
+		p_inst->k_acc = ( acc * dt * dt );
+
+		// Init success
+		p_inst->init = RATE_LIMITER_ACC_INIT_MAGIC;
+	}
+	else
+	{
+		status = eRATE_LIMITER_ERROR;
+	}
+
+	return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/*!
+* @brief    Update second order rate limiter
+*
+* @param[in]  	p_inst		- Pointer to second order rate limiter instance
+* @param[in]  	x			- Input signal
+* @return       y			- Output (rate and acceleration limited) signal
+*/
+////////////////////////////////////////////////////////////////////////////////
+float32_t rate_limiter_acc_update(rate_limiter_acc_t * const p_inst, const float32_t x)
+{
+	float32_t y = 0.0f;
+
+	// Check for instance and initialization
+	if ( NULL != p_inst )
+	{
+		if ( RATE_LIMITER_ACC_INIT_MAGIC == p_inst->init )
+		{
+			y = rate_limiter_acc_limit( x, &p_inst->x_prev, &p_inst->x_res, &p_inst->v_prev, p_inst->k_rise, p_inst->k_fall, p_inst->k_acc );
+		}
+	}
+
+	return y;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/*!
+* @brief    Update second order rate limiter over block of samples
+*
+* @note Input and output buffer may point to the same location.
+*
+* @param[in]  	p_inst		- Pointer to second order rate limiter instance
+* @param[in]  	p_x			- Pointer to input signal samples
+* @param[out]  	p_y			- Pointer to output (limited) signal samples
+* @param[in]  	size		- Number of samples in block
+* @return       status		- Either OK or Error
+*/
+////////////////////////////////////////////////////////////////////////////////
+rate_limiter_status_t rate_limiter_acc_update_block(rate_limiter_acc_t * const p_inst, const float32_t * const p_x, float32_t * const p_y, const size_t size)
+{
+	rate_limiter_status_t 	status 	= eRATE_LIMITER_ERROR;
+	float32_t				x_prev	= 0.0f;
+	float32_t				x_res	= 0.0f;
+	float32_t				v_prev	= 0.0f;
+	size_t					i		= 0;
+
+	// Check for instance, initialization and buffers
+	if 	(	( NULL != p_inst )
+		&&	( NULL != p_x )
+		&&	( NULL != p_y ))
+	{
+		if ( RATE_LIMITER_ACC_INIT_MAGIC == p_inst->init )
+		{
+			x_prev = p_inst->x_prev;
+			x_res = p_inst->x_res;
+			v_prev = p_inst->v_prev;
+
+			for ( i = 0; i < size; i++ )
+			{
+				p_y[i] = rate_limiter_acc_limit( p_x[i], &x_prev, &x_res, &v_prev, p_inst->k_rise, p_inst->k_fall, p_inst->k_acc );
+			}
+
+			p_inst->x_prev = x_prev;
+			p_inst->x_res = x_res;
+			p_inst->v_prev = v_prev;
+
+			status = eRATE_LIMITER_OK;
+		}
+	}
+
+	return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/*!
+* @brief    Get success initialization flag of second order rate limiter
+*
+* @param[in]  	p_inst		- Pointer to second order rate limiter instance
+* @return       is_init		- Success initialization flag
+*/
+////////////////////////////////////////////////////////////////////////////////
+bool rate_limiter_acc_is_init(const rate_limiter_acc_t * const p_inst)
+{
+	bool is_init = false;
+
+	if ( NULL != p_inst )
+	{
+		is_init = ( RATE_LIMITER_ACC_INIT_MAGIC == p_inst->init );
+	}
+
+	return is_init;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/*!
+* @brief    Change limits of second order rate limiter
+*
+* @note Output state is kept, so change takes effect smoothly.
+*
+* @param[in]  	p_inst		- Pointer to second order rate limiter instance
+* @param[in]  	rise_rate	- Rising slew rate
+* @param[in]  	fall_rate	- Falling slew rate
+* @param[in]  	acc			- Acceleration limit
+* @return       status		- Either OK or Error
+*/
+////////////////////////////////////////////////////////////////////////////////
+rate_limiter_status_t rate_limiter_acc_change_rate(rate_limiter_acc_t * const p_inst, const float32_t rise_rate, const float32_t fall_rate, const float32_t acc)
+{
+	rate_limiter_status_t status = eRATE_LIMITER_ERROR;
+
+	// Check for instance, initialization and rates
+	if 	(	( true == rate_limiter_acc_is_init( p_inst ))
+		&&	( true == rate_limiter_acc_check_rate( rise_rate, fall_rate, acc )))
+	{
+		p_inst->k_rise = rate_limiter_calc_rate_factor( p_inst->dt, rise_rate );
+		p_inst->k_fall = rate_limiter_calc_rate_factor( p_inst->dt, fall_rate );
+		p_inst->k_acc = ( acc * p_inst->dt * p_inst->dt );
+
+		status = eRATE_LIMITER_OK;
+	}
+
+	return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/*!
+* @brief    Get current rate of second order rate limiter output
+*
+* @note Useful as velocity feed forward of limited setpoint.
+*
+* @param[in]  	p_inst		- Pointer to second order rate limiter instance
+* @return       rate		- Output rate in unit/sec
+*/
+////////////////////////////////////////////////////////////////////////////////
+float32_t rate_limiter_acc_get_rate(const rate_limiter_acc_t * const p_inst)
+{
+	float32_t rate = 0.0f;
+
+	if ( true == rate_limiter_acc_is_init( p_inst ))
+	{
+		rate = ( p_inst->v_prev / p_inst->dt );
+	}
+
+	return rate;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/*!
+* @brief    Initialize second order rate limiter bank
+*
+* @param[out]  	p_bank		- Pointer to second order rate limiter bank
+* @param[in]  	num_of_ch	- Number of channels
+* @param[in]  	rise_rate	- Rising slew rate
+* @param[in]  	fall_rate	- Falling slew rate
+* @param[in]  	acc			- Acceleration limit
+* @param[in]  	dt			- Update (period) time
+* @return       status		- Either OK or Error
+*/
+////////////////////////////////////////////////////////////////////////////////
+rate_limiter_status_t rate_limiter_acc_bank_init(p_rate_limiter_acc_bank_t * p_bank, const uint32_t num_of_ch, const float32_t rise_rate, const float32_t fall_rate, const float32_t acc, const float32_t dt)
+{
+	rate_limiter_status_t 	status 		= eRATE_LIMITER_OK;
+	uint32_t				stride		= 0;
+	uintptr_t				addr		= 0;
+	uint32_t				ch			= 0;
+
+	if 	(	( NULL != p_bank )
+		&&	( num_of_ch > 0U )
+		&& 	( dt > 0.0f )
+		&&	( true == rate_limiter_acc_check_rate( rise_rate, fall_rate, acc )))
+	{
+		// Allocate space
+		*p_bank = malloc( sizeof( rate_limiter_acc_bank_t ));
+
+		if ( NULL != *p_bank )
+		{
+			// Round array length up to whole aligned blocks
+			stride = (( num_of_ch + RATE_LIMITER_ACC_CH_PER_ALIGN - 1U ) / RATE_LIMITER_ACC_CH_PER_ALIGN ) * RATE_LIMITER_ACC_CH_PER_ALIGN;
+
+			// Allocate all arrays as single block with spare space for alignment
+			(*p_bank)->p_mem = malloc(( 6U * stride * sizeof( float32_t )) + RATE_LIMITER_BANK_ALIGN );
+
+			if ( NULL != (*p_bank)->p_mem )
+			{
+				// Align arrays
+				addr = ((uintptr_t) (*p_bank)->p_mem + RATE_LIMITER_BANK_ALIGN - 1U ) & ~((uintptr_t) RATE_LIMITER_BANK_ALIGN - 1U );
+
+				(*p_bank)->p_x_prev = (float32_t*) addr;
+				(*p_bank)->p_x_res = (*p_bank)->p_x_prev + stride;
+				(*p_bank)->p_v_prev = (*p_bank)->p_x_res + stride;
+				(*p_bank)->p_k_rise = (*p_bank)->p_v_prev + stride;
+				(*p_bank)->p_k_fall = (*p_bank)->p_k_rise + stride;
+				(*p_bank)->p_k_acc = (*p_bank)->p_k_fall + stride;
+
+				// Init channels
+				for ( ch = 0; ch < stride; ch++ )
+				{
+					(*p_bank)->p_x_prev[ch] = 0.0f;
+					(*p_bank)->p_x_res[ch] = 0.0f;
+					(*p_bank)->p_v_prev[ch] = 0.0f;
+					(*p_bank)->p_k_rise[ch] = rate_limiter_calc_rate_factor( dt, rise_rate );
+					(*p_bank)->p_k_fall[ch] = rate_limiter_calc_rate_factor( dt, fall_rate );
+					(*p_bank)->p_k_acc[ch] = ( acc * dt * dt );
+				}
+
+				(*p_bank)->dt = dt;
+				(*p_bank)->num_of_ch = num_of_ch;
+
+				// Init success
+				(*p_bank)->is_init = true;
+			}
+			else
+			{
+				free( *p_bank );
+				*p_bank = NULL;
+
+				status = eRATE_LIMITER_ERROR;
+			}
+		}
+		else
+		{
+			status = eRATE_LIMITER_ERROR;
+		}
+	}
+	else
+	{
+		status = eRATE_LIMITER_ERROR;
+	}
+
+	return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/*!
+* @brief    De-initialize second order rate limiter bank
+*
+* @param[in,out]  	p_bank		- Pointer to second order rate limiter bank
+* @return       	status		- Either OK or Error
+*/
+////////////////////////////////////////////////////////////////////////////////
+rate_limiter_status_t rate_limiter_acc_bank_deinit(p_rate_limiter_acc_bank_t * p_bank)
+{
+	rate_limiter_status_t status = eRATE_LIMITER_ERROR;
+
+	// Check for bank and initialization
+	if ( NULL != p_bank )
+	{
+		if ( true == rate_limiter_acc_bank_is_init( *p_bank ))
+		{
+			(*p_bank)->is_init = false;
+
+			free( (*p_bank)->p_mem );
+			free( *p_bank );
+
+			*p_bank = NULL;
+
+			status = eRATE_LIMITER_OK;
+		}
+	}
+
+	return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/*!
+* @brief    Update all channels of second order rate limiter bank
+*
+* @note Input and output buffer must hold at least number of channels
+* 		samples and may point to the same location. All channel arrays
+* 		are read and written in single pass.
+*
+* @param[in]  	bank		- Pointer to second order rate limiter bank
+* @param[in]  	p_x			- Pointer to input signals, one per channel
+* @param[out]  	p_y			- Pointer to output (limited) signals, one per channel
+* @return       status		- Either OK or Error
+*/
+////////////////////////////////////////////////////////////////////////////////
+rate_limiter_status_t rate_limiter_acc_bank_update(p_rate_limiter_acc_bank_t bank, const float32_t * const p_x, float32_t * const p_y)
+{
+	rate_limiter_status_t status = eRATE_LIMITER_ERROR;
+
+	// Check for bank, initialization and buffers
+	if 	(	( NULL != bank )
+		&&	( NULL != p_x )
+		&&	( NULL != p_y ))
+	{
+		if ( true == bank->is_init )
+		{
+			rate_limiter_acc_bank_kernel( p_x, p_y, bank->p_x_prev, bank->p_x_res, bank->p_v_prev, bank->p_k_rise, bank->p_k_fall, bank->p_k_acc, bank->num_of_ch );
+
+			status = eRATE_LIMITER_OK;
+		}
+	}
+
+	return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/*!
+* @brief    Get success initialization flag of second order bank
+*
+* @param[in]  	bank		- Pointer to second order rate limiter bank
+* @return       is_init		- Success initialization flag
+*/
+////////////////////////////////////////////////////////////////////////////////
+bool rate_limiter_acc_bank_is_init(p_rate_limiter_acc_bank_t bank)
+{
+	bool is_init = false;
+
+	if ( NULL != bank )
+	{
+		is_init = bank->is_init;
+	}
+
+	return is_init;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/*!
+* @brief    Change limits of single second order bank channel
+*
+* @param[in]  	bank		- Pointer to second order rate limiter bank
+* @param[in]  	ch			- Channel index
+* @param[in]  	rise_rate	- Rising slew rate
+* @param[in]  	fall_rate	- Falling slew rate
+* @param[in]  	acc			- Acceleration limit
+* @return       status		- Either OK or Error
+*/
+////////////////////////////////////////////////////////////////////////////////
+rate_limiter_status_t rate_limiter_acc_bank_change_rate(p_rate_limiter_acc_bank_t bank, const uint32_t ch, const float32_t rise_rate, const float32_t fall_rate, const float32_t acc)
+{
+	rate_limiter_status_t status = eRATE_LIMITER_ERROR;
+
+	// Check for bank, initialization, channel and rates
+	if ( NULL != bank )
+	{
+		if 	(	( true == bank->is_init )
+			&&	( ch < bank->num_of_ch )
+			&&	( true == rate_limiter_acc_check_rate( rise_rate, fall_rate, acc )))
+		{
+			bank->p_k_rise[ch] = rate_limiter_calc_rate_factor( bank->dt, rise_rate );
+			bank->p_k_fall[ch] = rate_limiter_calc_rate_factor( bank->dt, fall_rate );
+			bank->p_k_acc[ch] = ( acc * bank->dt * bank->dt );
+
+			status = eRATE_LIMITER_OK;
+		}
+	}
+
+	return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+* @} <!-- END GROUP -->
+*/
+////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,1870 @@
+// Copyright (c) 2021 Ziga Miklosic
+// All Rights Reserved
+// This software is under MIT licence (https://opensource.org/licenses/MIT)
+////////////////////////////////////////////////////////////////////////////////
+/**
+*@file      rate_limiter_bank.c
+*@brief     Multi-channel rate limiter bank
+*@author    Ziga Miklosic
+*@date      19.02.2021
+*@version   V1.1.0
+*
+*@section Description
+*
+*	Rate limiter bank holds large number of rate limiter channels in
+*	structure-of-arrays form. Previous values and rise/fall factors of
+*	all channels are stored in parallel, aligned arrays, allocated as
+*	a single block of memory. All channels are updated in a single pass
+*	that compiler can auto-vectorize.
+*
+*	Each channel gives bit exact result as an individual rate limiter
+*	instance with the same parameters.
+*
+*	With RATE_LIMITER_BANK_SIMD_EN enabled, best hand written SIMD kernel
+*	for running CPU is selected at bank initialization.
+*
+*@section Code_example
+*@code
+*
+*	// Declare rate limiter bank pointer
+*	static p_rate_limiter_bank_t my_bank = NULL;
+*
+*	// Initialize
+*	if ( eRATE_LIMITER_OK != rate_limiter_bank_init( &my_bank, NUM_OF_CH, rise_rate, fall_rate, period_time ))
+*	{
+*		// Init failed...
+*		// Furhter actions here...
+*	}
+*
+*	// Update all channels
+*	@period_time
+*	{
+*		rate_limiter_bank_update( my_bank, raw_signals, slew_rated_signals );
+*	}
+*
+*@endcode
+*
+*/
+////////////////////////////////////////////////////////////////////////////////
+/*!
+* @addtogroup RATE_LIMITER_BANK
+* @{ <!-- BEGIN GROUP -->
+*/
+////////////////////////////////////////////////////////////////////////////////
+
+#if !defined( _POSIX_C_SOURCE ) && !defined( _GNU_SOURCE )
+	#define _POSIX_C_SOURCE 200809L
+#endif
+
+////////////////////////////////////////////////////////////////////////////////
+// Includes
+////////////////////////////////////////////////////////////////////////////////
+#include "rate_limiter_bank.h"
+#include "rate_limiter_kernel.h"
+#include "rate_limiter_simd.h"
+
+#include <string.h>
+
+#if ( 1 == RATE_LIMITER_BANK_STAGE_EN )
+	#include <stdatomic.h>
+
+	#if ( 2 != ATOMIC_INT_LOCK_FREE )
+		#error "RATE_LIMITER_BANK_STAGE_EN requires lock-free 32-bit atomics!"
+	#endif
+#endif
+
+#if ( 1 == RATE_LIMITER_BANK_MMAP_EN )
+	#include <fcntl.h>
+	#include <sys/file.h>
+	#include <sys/mman.h>
+	#include <sys/stat.h>
+	#include <unistd.h>
+#endif
+
+////////////////////////////////////////////////////////////////////////////////
+// Definitions
+////////////////////////////////////////////////////////////////////////////////
+
+/**
+ * 	Number of channels per aligned array block
+ */
+#define RATE_LIMITER_BANK_CH_PER_ALIGN		( RATE_LIMITER_BANK_ALIGN / sizeof( float32_t ))
+
+/**
+ * 	Number of channels per active bitmap word
+ */
+#define RATE_LIMITER_BANK_CH_PER_WORD		( 32U )
+
+/**
+ * 	Exchanged slew rate factor set holds newly published rates
+ */
+#define RATE_LIMITER_BANK_SET_NEW			( 0x4U )
+
+/**
+ * 	Set index part of exchanged slew rate factor set
+ */
+#define RATE_LIMITER_BANK_SET_MASK			( 0x3U )
+
+/**
+ * 	Slew rate limiter bank
+ */
+typedef struct rate_limiter_bank_s
+{
+	float32_t *						p_x_prev;	/**<Previous values of channels */
+	float32_t *						p_k_rise;	/**<Rising slew rate factors of channels */
+	float32_t * 					p_k_fall;	/**<Falling slew rate factors of channels */
+	float32_t *						p_x_target;	/**<Target inputs of channels */
+	uint32_t *						p_active;	/**<Active (not settled) channels bitmap */
+#if ( 1 == RATE_LIMITER_BANK_STAGE_EN )
+	float32_t *						p_k_rise_set[3];	/**<Rising slew rate factor sets */
+	float32_t *						p_k_fall_set[3];	/**<Falling slew rate factor sets */
+	_Atomic uint32_t				shared_set;	/**<Set exchanged between threads, with RATE_LIMITER_BANK_SET_NEW flag */
+	uint32_t						active_set;	/**<Set in use, private to update thread */
+	uint32_t						stage_set;	/**<Set being staged, private to staging thread */
+	uint32_t						latest_set;	/**<Last published set, private to staging thread */
+	bool							is_staging;	/**<Pending set is being staged */
+#endif
+	void *							p_mem;		/**<Allocated memory space of channel arrays */
+#if ( 1 == RATE_LIMITER_BANK_MMAP_EN )
+	void *							p_map;		/**<Mapped file of channel arrays, NULL when allocated */
+	size_t							map_size;	/**<Size of mapped file */
+	int								map_fd;		/**<Locked descriptor of mapped file */
+#endif
+	pf_rate_limiter_bank_kernel_t	pf_kernel;	/**<Update kernel */
+	float32_t 						dt;			/**<Period of update */
+	uint32_t						num_of_ch;	/**<Number of channels */
+	bool							is_init;	/**<Rate limiter bank initialization success flag */
+} rate_limiter_bank_t;
+
+////////////////////////////////////////////////////////////////////////////////
+// Variables
+////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////
+// Function prototypes
+////////////////////////////////////////////////////////////////////////////////
+static void 		rate_limiter_bank_update_kernel	(const float32_t * const p_x, float32_t * const p_y, float32_t * const p_x_prev, const float32_t * const p_k_rise, const float32_t * const p_k_fall, const uint32_t num_of_ch);
+static uint32_t 	rate_limiter_bank_ctz			(const uint32_t word);
+static uint32_t 	rate_limiter_bank_popcount		(const uint32_t word);
+static void			rate_limiter_bank_update_active_words(p_rate_limiter_bank_t bank, const uint32_t first_word, const uint32_t end_word);
+static void			rate_limiter_bank_calc_factors	(const float32_t dt, const float32_t * const p_rate, float32_t * const p_k, const uint32_t num_of_ch);
+static bool			rate_limiter_bank_check_idx		(const uint32_t * const p_idx, const uint32_t num, const uint32_t num_of_ch);
+static void			rate_limiter_bank_scatter_factors(const float32_t dt, const uint32_t * const p_idx, const float32_t * const p_rise, const float32_t * const p_fall, float32_t * const p_k_rise, float32_t * const p_k_fall, const uint32_t num);
+static uint32_t		rate_limiter_bank_calc_stride	(const uint32_t num_of_ch);
+static uint64_t		rate_limiter_bank_calc_snapshot_size(const uint32_t stride);
+static void			rate_limiter_bank_setup			(p_rate_limiter_bank_t bank, void * const p_arrays, float32_t * const p_k_pending, const uint32_t num_of_ch, const float32_t rise_rate, const float32_t fall_rate, const float32_t dt, const bool reset);
+
+static void			rate_limiter_bank_begin_change	(p_rate_limiter_bank_t bank, float32_t ** const pp_k_rise, float32_t ** const pp_k_fall);
+static void			rate_limiter_bank_end_change	(p_rate_limiter_bank_t bank);
+
+#if ( 1 == RATE_LIMITER_BANK_STAGE_EN )
+	static void		rate_limiter_bank_reset_sets	(p_rate_limiter_bank_t bank);
+	static void		rate_limiter_bank_apply_pending	(p_rate_limiter_bank_t bank);
+	static bool		rate_limiter_bank_begin_stage	(p_rate_limiter_bank_t bank);
+	static void		rate_limiter_bank_publish		(p_rate_limiter_bank_t bank);
+#endif
+
+////////////////////////////////////////////////////////////////////////////////
+// Functions
+////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////
+/*!
+* @brief    Update all channels of bank
+*
+* @note Loop has no dependency between iterations, state arrays are
+* 		not aliased and limiting is done in select form, thus compiler
+* 		is free to vectorize it.
+*
+* @param[in]  	p_x			- Pointer to input signals
+* @param[out]  	p_y			- Pointer to output (slew limited) signals
+* @param[in]  	p_x_prev	- Pointer to previous values
+* @param[in]  	p_k_rise	- Pointer to rising slew rate factors
+* @param[in]  	p_k_fall	- Pointer to falling slew rate factors
+* @param[in]  	num_of_ch	- Number of channels
+* @return       void
+*/
+////////////////////////////////////////////////////////////////////////////////
+static void rate_limiter_bank_update_kernel(const float32_t * const p_x, float32_t * const p_y, float32_t * const p_x_prev, const float32_t * const p_k_rise, const float32_t * const p_k_fall, const uint32_t num_of_ch)
+{
+	float32_t * restrict 		x_prev 	= p_x_prev;
+	const float32_t * restrict 	k_rise 	= p_k_rise;
+	const float32_t * restrict 	k_fall 	= p_k_fall;
+	float32_t 					y		= 0.0f;
+	uint32_t					ch		= 0;
+
+	for ( ch = 0; ch < num_of_ch; ch++ )
+	{
+		y = rate_limiter_limit_sel( p_x[ch], x_prev[ch], k_rise[ch], k_fall[ch] );
+
+		x_prev[ch] 	= y;
+		p_y[ch]		= y;
+	}
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/*!
+* @brief    Count trailing zero bits
+*
+* @param[in]  	word		- Non-zero word
+* @return       num			- Index of lowest set bit
+*/
+////////////////////////////////////////////////////////////////////////////////
+static uint32_t rate_limiter_bank_ctz(const uint32_t word)
+{
+	uint32_t num = 0;
+
+	#if defined( __GNUC__ )
+		num = (uint32_t) __builtin_ctz( word );
+	#else
+		while ( 0U == ( word & ( 1UL << num )))
+		{
+			num++;
+		}
+	#endif
+
+	return num;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/*!
+* @brief    Count set bits
+*
+* @param[in]  	word		- Word
+* @return       num			- Number of set bits
+*/
+////////////////////////////////////////////////////////////////////////////////
+static uint32_t rate_limiter_bank_popcount(const uint32_t word)
+{
+	uint32_t num = 0;
+
+	#if defined( __GNUC__ )
+		num = (uint32_t) __builtin_popcount( word );
+	#else
+		uint32_t bits = word;
+
+		while ( 0U != bits )
+		{
+			bits &= ( bits - 1U );
+			num++;
+		}
+	#endif
+
+	return num;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/*!
+* @brief    Update active channels of range of bitmap words
+*
+* @note Walks set bits of active bitmap and clears channels that reached
+* 		their target.
+*
+* @param[in]  	bank		- Pointer to rate limiter bank
+* @param[in]  	first_word	- First bitmap word
+* @param[in]  	end_word	- One past last bitmap word
+* @return       void
+*/
+////////////////////////////////////////////////////////////////////////////////
+static void rate_limiter_bank_update_active_words(p_rate_limiter_bank_t bank, const uint32_t first_word, const uint32_t end_word)
+{
+	uint32_t	word		= 0;
+	uint32_t	bits		= 0;
+	uint32_t	settled		= 0;
+	uint32_t	bit			= 0;
+	uint32_t	ch			= 0;
+
+	for ( word = first_word; word < end_word; word++ )
+	{
+		bits = bank->p_active[word];
+		settled = 0U;
+
+		while ( 0U != bits )
+		{
+			bit = rate_limiter_bank_ctz( bits );
+			bits &= ( bits - 1U );
+
+			ch = ( word * RATE_LIMITER_BANK_CH_PER_WORD ) + bit;
+
+			bank->p_x_prev[ch] = rate_limiter_limit( bank->p_x_target[ch], bank->p_x_prev[ch], bank->p_k_rise[ch], bank->p_k_fall[ch] );
+
+			// Target reached
+			if ( bank->p_x_prev[ch] == bank->p_x_target[ch] )
+			{
+				settled |= ( 1UL << bit );
+			}
+		}
+
+		bank->p_active[word] &= ~settled;
+	}
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/*!
+* @brief    Calculate slew rate factors of consecutive channels
+*
+* @note No dependency between iterations and arrays are not aliased, thus
+* 		compiler is free to vectorize it.
+*
+* @param[in]  	dt			- Update (period) time
+* @param[in]  	p_rate		- Pointer to slew rates
+* @param[out]  	p_k			- Pointer to slew rate factors
+* @param[in]  	num_of_ch	- Number of channels
+* @return       void
+*/
+////////////////////////////////////////////////////////////////////////////////
+static void rate_limiter_bank_calc_factors(const float32_t dt, const float32_t * const p_rate, float32_t * const p_k, const uint32_t num_of_ch)
+{
+	const float32_t * restrict 	rate 	= p_rate;
+	float32_t * restrict 		k 		= p_k;
+	uint32_t					ch		= 0;
+
+	for ( ch = 0; ch < num_of_ch; ch++ )
+	{
+		k[ch] = rate_limiter_calc_rate_factor( dt, rate[ch] );
+	}
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/*!
+* @brief    Check that all channel indices are inside bank
+*
+* @note Whole list is checked before any channel is changed, so invalid
+* 		list leaves bank untouched. Reduction without early exit.
+*
+* @param[in]  	p_idx		- Pointer to channel indices
+* @param[in]  	num			- Number of indices
+* @param[in]  	num_of_ch	- Number of channels of bank
+* @return       valid		- True when all indices are valid
+*/
+////////////////////////////////////////////////////////////////////////////////
+static bool rate_limiter_bank_check_idx(const uint32_t * const p_idx, const uint32_t num, const uint32_t num_of_ch)
+{
+	uint32_t	invalid	= 0;
+	uint32_t	i		= 0;
+
+	for ( i = 0; i < num; i++ )
+	{
+		invalid |= (uint32_t)( p_idx[i] >= num_of_ch );
+	}
+
+	return ( 0U == invalid );
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/*!
+* @brief    Calculate slew rate factors of listed channels
+*
+* @note When channel is listed multiple times, last entry wins.
+*
+* @param[in]  	dt			- Update (period) time
+* @param[in]  	p_idx		- Pointer to channel indices
+* @param[in]  	p_rise		- Pointer to rising slew rates, one per index
+* @param[in]  	p_fall		- Pointer to falling slew rates, one per index
+* @param[out]  	p_k_rise	- Pointer to rising slew rate factors of bank
+* @param[out]  	p_k_fall	- Pointer to falling slew rate factors of bank
+* @param[in]  	num			- Number of indices
+* @return       void
+*/
+////////////////////////////////////////////////////////////////////////////////
+static void rate_limiter_bank_scatter_factors(const float32_t dt, const uint32_t * const p_idx, const float32_t * const p_rise, const float32_t * const p_fall, float32_t * const p_k_rise, float32_t * const p_k_fall, const uint32_t num)
+{
+	uint32_t i = 0;
+
+	for ( i = 0; i < num; i++ )
+	{
+		p_k_rise[ p_idx[i] ] = rate_limiter_calc_rate_factor( dt, p_rise[i] );
+		p_k_fall[ p_idx[i] ] = rate_limiter_calc_rate_factor( dt, p_fall[i] );
+	}
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/*!
+* @brief    Calculate length of channel arrays
+*
+* @param[in]  	num_of_ch	- Number of channels
+* @return       stride		- Number of channels rounded up to whole aligned blocks
+*/
+////////////////////////////////////////////////////////////////////////////////
+static uint32_t rate_limiter_bank_calc_stride(const uint32_t num_of_ch)
+{
+	return (( num_of_ch + RATE_LIMITER_BANK_CH_PER_ALIGN - 1U ) / RATE_LIMITER_BANK_CH_PER_ALIGN ) * RATE_LIMITER_BANK_CH_PER_ALIGN;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/*!
+* @brief    Calculate size of bank snapshot
+*
+* @note Header is followed by previous values, rising and falling slew
+* 		rate factors and target inputs, each stride channels long, and by
+* 		active channels bitmap.
+*
+* @param[in]  	stride		- Length of channel arrays
+* @return       size		- Snapshot size in bytes
+*/
+////////////////////////////////////////////////////////////////////////////////
+static uint64_t rate_limiter_bank_calc_snapshot_size(const uint32_t stride)
+{
+	const uint64_t num_of_word = (( (uint64_t) stride + RATE_LIMITER_BANK_CH_PER_WORD - 1U ) / RATE_LIMITER_BANK_CH_PER_WORD );
+
+	return ( sizeof( rate_limiter_snapshot_header_t ) + ( 4U * (uint64_t) stride * sizeof( float32_t )) + ( num_of_word * sizeof( uint32_t )));
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/*!
+* @brief    Setup bank on channel arrays memory
+*
+* @note Arrays memory has layout of bank snapshot without header, so that
+* 		it can be file backed. Pending slew rate factors (two sets of two
+* 		arrays, RATE_LIMITER_BANK_STAGE_EN only) are kept apart, NULL
+* 		disables staging.
+*
+* @param[in]  	bank		- Pointer to rate limiter bank
+* @param[in]  	p_arrays	- Pointer to aligned channel arrays
+* @param[in]  	p_k_pending	- Pointer to pending slew rate factor arrays
+* @param[in]  	num_of_ch	- Number of channels
+* @param[in]  	rise_rate	- Rising slew rate
+* @param[in]  	fall_rate	- Falling slew rate
+* @param[in]  	dt			- Update (period) time
+* @param[in]  	reset		- Initialize channels, otherwise state is kept
+* @return       void
+*/
+////////////////////////////////////////////////////////////////////////////////
+static void rate_limiter_bank_setup(p_rate_limiter_bank_t bank, void * const p_arrays, float32_t * const p_k_pending, const uint32_t num_of_ch, const float32_t rise_rate, const float32_t fall_rate, const float32_t dt, const bool reset)
+{
+	const uint32_t	stride		= rate_limiter_bank_calc_stride( num_of_ch );
+	const uint32_t	num_of_word	= (( stride + RATE_LIMITER_BANK_CH_PER_WORD - 1U ) / RATE_LIMITER_BANK_CH_PER_WORD );
+	float32_t		k_rise		= 0.0f;
+	float32_t		k_fall		= 0.0f;
+	uint32_t		ch			= 0;
+
+	#if ( 1 == RATE_LIMITER_BANK_SIMD_EN )
+		pf_rate_limiter_bank_kernel_t pf_simd = NULL;
+	#endif
+
+	bank->p_x_prev = (float32_t*) p_arrays;
+	bank->p_k_rise = bank->p_x_prev + stride;
+	bank->p_k_fall = bank->p_k_rise + stride;
+	bank->p_x_target = bank->p_k_fall + stride;
+	bank->p_active = (uint32_t*)( bank->p_x_target + stride );
+
+	#if ( 1 == RATE_LIMITER_BANK_STAGE_EN )
+		bank->p_k_rise_set[0] = bank->p_k_rise;
+		bank->p_k_fall_set[0] = bank->p_k_fall;
+		bank->p_k_rise_set[1] = p_k_pending;
+		bank->p_k_fall_set[1] = ( NULL != p_k_pending ) ? ( p_k_pending + stride ) : NULL;
+		bank->p_k_rise_set[2] = ( NULL != p_k_pending ) ? ( p_k_pending + ( 2U * stride )) : NULL;
+		bank->p_k_fall_set[2] = ( NULL != p_k_pending ) ? ( p_k_pending + ( 3U * stride )) : NULL;
+
+		atomic_init( &bank->shared_set, 1U );
+		rate_limiter_bank_reset_sets( bank );
+	#else
+		(void) p_k_pending;
+	#endif
+
+	if ( true == reset )
+	{
+		// Calculate rise/fall factors
+		k_rise = rate_limiter_calc_rate_factor( dt, rise_rate );
+		k_fall = rate_limiter_calc_rate_factor( dt, fall_rate );
+
+		// Init channels
+		for ( ch = 0; ch < stride; ch++ )
+		{
+			bank->p_x_prev[ch] = 0.0f;
+			bank->p_k_rise[ch] = k_rise;
+			bank->p_k_fall[ch] = k_fall;
+			bank->p_x_target[ch] = 0.0f;
+		}
+
+		// All channels settled
+		for ( ch = 0; ch < num_of_word; ch++ )
+		{
+			bank->p_active[ch] = 0U;
+		}
+	}
+
+	bank->dt = dt;
+	bank->num_of_ch = num_of_ch;
+
+	// Select update kernel
+	bank->pf_kernel = &rate_limiter_bank_update_kernel;
+
+	#if ( 1 == RATE_LIMITER_BANK_SIMD_EN )
+		pf_simd = rate_limiter_simd_get_bank_kernel();
+
+		if ( NULL != pf_simd )
+		{
+			bank->pf_kernel = pf_simd;
+		}
+	#endif
+
+	// Init success
+	bank->is_init = true;
+}
+
+#if ( 1 == RATE_LIMITER_BANK_STAGE_EN )
+
+	////////////////////////////////////////////////////////////////////////////////
+	/*!
+	* @brief    Reset slew rate factor sets
+	*
+	* @note Update uses first set, second is exchanged and third staged.
+	* 		Staged and published sets are dropped.
+	*
+	* @param[in]  	bank		- Pointer to rate limiter bank
+	* @return       void
+	*/
+	////////////////////////////////////////////////////////////////////////////////
+	static void rate_limiter_bank_reset_sets(p_rate_limiter_bank_t bank)
+	{
+		bank->p_k_rise = bank->p_k_rise_set[0];
+		bank->p_k_fall = bank->p_k_fall_set[0];
+
+		atomic_store_explicit( &bank->shared_set, 1U, memory_order_relaxed );
+		bank->active_set = 0U;
+		bank->stage_set = 2U;
+		bank->latest_set = 0U;
+		bank->is_staging = false;
+	}
+
+	////////////////////////////////////////////////////////////////////////////////
+	/*!
+	* @brief    Switch to published slew rate factor set
+	*
+	* @note Called by update thread at block boundary only. Newly published
+	* 		set is exchanged for set in use, which is thus handed back to
+	* 		staging thread only after it is no longer read.
+	*
+	* @param[in]  	bank		- Pointer to rate limiter bank
+	* @return       void
+	*/
+	////////////////////////////////////////////////////////////////////////////////
+	static void rate_limiter_bank_apply_pending(p_rate_limiter_bank_t bank)
+	{
+		uint32_t set = 0;
+
+		if ( 0U != ( atomic_load_explicit( &bank->shared_set, memory_order_relaxed ) & RATE_LIMITER_BANK_SET_NEW ))
+		{
+			set = ( atomic_exchange_explicit( &bank->shared_set, bank->active_set, memory_order_acq_rel ) & RATE_LIMITER_BANK_SET_MASK );
+
+			bank->active_set = set;
+			bank->p_k_rise = bank->p_k_rise_set[set];
+			bank->p_k_fall = bank->p_k_fall_set[set];
+		}
+	}
+
+	////////////////////////////////////////////////////////////////////////////////
+	/*!
+	* @brief    Prepare pending slew rate factor set for staging
+	*
+	* @note First stage after commit copies last published set to staged
+	* 		set. Staged set is owned by staging thread, thus it is always
+	* 		available, regardless of update thread. File backed bank has
+	* 		no pending sets and can not stage.
+	*
+	* @param[in]  	bank		- Pointer to rate limiter bank
+	* @return       ready		- True when pending set can be written
+	*/
+	////////////////////////////////////////////////////////////////////////////////
+	static bool rate_limiter_bank_begin_stage(p_rate_limiter_bank_t bank)
+	{
+		if 	(	( false == bank->is_staging )
+			&&	( NULL != bank->p_k_rise_set[1] ))
+		{
+			memcpy( bank->p_k_rise_set[ bank->stage_set ], bank->p_k_rise_set[ bank->latest_set ], ( bank->num_of_ch * sizeof( float32_t )));
+			memcpy( bank->p_k_fall_set[ bank->stage_set ], bank->p_k_fall_set[ bank->latest_set ], ( bank->num_of_ch * sizeof( float32_t )));
+
+			bank->is_staging = true;
+		}
+
+		return bank->is_staging;
+	}
+
+	////////////////////////////////////////////////////////////////////////////////
+	/*!
+	* @brief    Publish staged slew rate factor set
+	*
+	* @note Staged set is exchanged for one handed back by update thread,
+	* 		which becomes next staged set.
+	*
+	* @param[in]  	bank		- Pointer to rate limiter bank
+	* @return       void
+	*/
+	////////////////////////////////////////////////////////////////////////////////
+	static void rate_limiter_bank_publish(p_rate_limiter_bank_t bank)
+	{
+		if ( true == bank->is_staging )
+		{
+			bank->latest_set = bank->stage_set;
+			bank->stage_set = ( atomic_exchange_explicit( &bank->shared_set, ( bank->stage_set | RATE_LIMITER_BANK_SET_NEW ), memory_order_acq_rel ) & RATE_LIMITER_BANK_SET_MASK );
+			bank->is_staging = false;
+		}
+	}
+
+#endif
+
+////////////////////////////////////////////////////////////////////////////////
+/*!
+* @brief    Get slew rate factor arrays for rate change
+*
+* @note With RATE_LIMITER_BANK_STAGE_EN change goes through staged set, so
+* 		that it does not race with staging and is not undone by commit.
+* 		Bank without pending sets (file backed) is changed in place.
+*
+* @param[in]  	bank		- Pointer to rate limiter bank
+* @param[out]  	pp_k_rise	- Rising slew rate factors to write
+* @param[out]  	pp_k_fall	- Falling slew rate factors to write
+* @return       void
+*/
+////////////////////////////////////////////////////////////////////////////////
+static void rate_limiter_bank_begin_change(p_rate_limiter_bank_t bank, float32_t ** const pp_k_rise, float32_t ** const pp_k_fall)
+{
+	*pp_k_rise = bank->p_k_rise;
+	*pp_k_fall = bank->p_k_fall;
+
+	#if ( 1 == RATE_LIMITER_BANK_STAGE_EN )
+		if ( true == rate_limiter_bank_begin_stage( bank ))
+		{
+			*pp_k_rise = bank->p_k_rise_set[ bank->stage_set ];
+			*pp_k_fall = bank->p_k_fall_set[ bank->stage_set ];
+		}
+	#endif
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/*!
+* @brief    Finish rate change
+*
+* @note With RATE_LIMITER_BANK_STAGE_EN staged set is published.
+*
+* @param[in]  	bank		- Pointer to rate limiter bank
+* @return       void
+*/
+////////////////////////////////////////////////////////////////////////////////
+static void rate_limiter_bank_end_change(p_rate_limiter_bank_t bank)
+{
+	#if ( 1 == RATE_LIMITER_BANK_STAGE_EN )
+		rate_limiter_bank_publish( bank );
+	#else
+		(void) bank;
+	#endif
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+* @} <!-- END GROUP -->
+*/
+////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*@addtogroup RATE_LIMITER_BANK_API
+* @{ <!-- BEGIN GROUP -->
+*
+* 	Following function are part or rate limiter bank API.
+*/
+////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////
+/*!
+* @brief    Initialize rate limiter bank
+*
+* @note All channels are initialized with the same rising/falling slew
+* 		rate. Rates of individual channels can later be changed with
+* 		"rate_limiter_bank_change_rate()".
+*
+* 		Slew rate units are the same as with "rate_limiter_init()".
+*
+* @param[out]  	p_bank		- Pointer to rate limiter bank
+* @param[in]  	num_of_ch	- Number of channels
+* @param[in]  	rise_rate	- Rising slew rate
+* @param[in]  	fall_rate	- Falling slew rate
+* @param[in]  	dt			- Update (period) time
+* @return       status		- Either OK or Error
+*/
+////////////////////////////////////////////////////////////////////////////////
+rate_limiter_status_t rate_limiter_bank_init(p_rate_limiter_bank_t * p_bank, const uint32_t num_of_ch, const float32_t rise_rate, const float32_t fall_rate, const float32_t dt)
+{
+	rate_limiter_status_t 	status 			= eRATE_LIMITER_OK;
+	size_t					arrays_size		= 0;
+	size_t					pending_size	= 0;
+	uintptr_t				addr			= 0;
+	float32_t *				p_k_pending		= NULL;
+
+	if 	(	( NULL != p_bank )
+		&&	( num_of_ch > 0U )
+		&& 	( dt > 0.0f ))
+	{
+		// Allocate space
+		*p_bank = malloc( sizeof( rate_limiter_bank_t ));
+
+		if ( NULL != *p_bank )
+		{
+			// Arrays are rounded up to whole aligned blocks, as in snapshot
+			arrays_size = (size_t)( rate_limiter_bank_calc_snapshot_size( rate_limiter_bank_calc_stride( num_of_ch )) - sizeof( rate_limiter_snapshot_header_t ));
+			arrays_size = ( arrays_size + RATE_LIMITER_BANK_ALIGN - 1U ) & ~((size_t) RATE_LIMITER_BANK_ALIGN - 1U );
+
+			#if ( 1 == RATE_LIMITER_BANK_STAGE_EN )
+				pending_size = ( 4U * rate_limiter_bank_calc_stride( num_of_ch ) * sizeof( float32_t ));
+			#endif
+
+			// Allocate all arrays as single block with spare space for alignment
+			(*p_bank)->p_mem = malloc( arrays_size + pending_size + RATE_LIMITER_BANK_ALIGN );
+
+			#if ( 1 == RATE_LIMITER_BANK_MMAP_EN )
+				(*p_bank)->p_map = NULL;
+				(*p_bank)->map_size = 0U;
+				(*p_bank)->map_fd = -1;
+			#endif
+
+			if ( NULL != (*p_bank)->p_mem )
+			{
+				// Align arrays
+				addr = ((uintptr_t) (*p_bank)->p_mem + RATE_LIMITER_BANK_ALIGN - 1U ) & ~((uintptr_t) RATE_LIMITER_BANK_ALIGN - 1U );
+
+				if ( pending_size > 0U )
+				{
+					p_k_pending = (float32_t*)( addr + arrays_size );
+				}
+
+				rate_limiter_bank_setup( *p_bank, (void*) addr, p_k_pending, num_of_ch, rise_rate, fall_rate, dt, true );
+			}
+			else
+			{
+				free( *p_bank );
+				*p_bank = NULL;
+
+				status = eRATE_LIMITER_ERROR;
+			}
+		}
+		else
+		{
+			status = eRATE_LIMITER_ERROR;
+		}
+	}
+	else
+	{
+		status = eRATE_LIMITER_ERROR;
+	}
+
+	return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/*!
+* @brief    De-initialize rate limiter bank
+*
+* @note Bank memory is freed and bank pointer is set to NULL.
+*
+* @param[in,out]  	p_bank		- Pointer to rate limiter bank
+* @return       	status		- Either OK or Error
+*/
+////////////////////////////////////////////////////////////////////////////////
+rate_limiter_status_t rate_limiter_bank_deinit(p_rate_limiter_bank_t * p_bank)
+{
+	rate_limiter_status_t status = eRATE_LIMITER_ERROR;
+
+	// Check for bank and initialization
+	if ( NULL != p_bank )
+	{
+		if ( true == rate_limiter_bank_is_init( *p_bank ))
+		{
+			(*p_bank)->is_init = false;
+
+			#if ( 1 == RATE_LIMITER_BANK_MMAP_EN )
+				if ( NULL != (*p_bank)->p_map )
+				{
+					(void) munmap( (*p_bank)->p_map, (*p_bank)->map_size );
+
+					// Closing releases file lock
+					(void) close( (*p_bank)->map_fd );
+				}
+			#endif
+
+			free( (*p_bank)->p_mem );
+			free( *p_bank );
+
+			*p_bank = NULL;
+
+			status = eRATE_LIMITER_OK;
+		}
+	}
+
+	return status;
+}
+
+#if ( 1 == RATE_LIMITER_BANK_MMAP_EN )
+
+	////////////////////////////////////////////////////////////////////////////////
+	/*!
+	* @brief    Initialize file backed rate limiter bank
+	*
+	* @note Channel arrays live in file mapped with MAP_SHARED, laid out as
+	* 		bank snapshot (see "rate_limiter_bank_snapshot()"). Live state is
+	* 		thus always in page cache and survives process crash without any
+	* 		checkpoint. Power loss durability needs "rate_limiter_bank_sync()".
+	*
+	* 		New or empty file is sized and channels are initialized as with
+	* 		"rate_limiter_bank_init()". Existing file with valid header of
+	* 		same number of channels is resumed as is: state, slew rate factors
+	* 		and period are taken from file, given rates and dt are ignored.
+	* 		File of bank size with header never written (interrupted creation)
+	* 		is initialized as new. Any other file is left untouched and error
+	* 		is returned.
+	*
+	* 		File is locked (flock) until bank de-initialization, thus file
+	* 		already in use by another bank or process is rejected.
+	*
+	* 		After crash during update file holds tick that was in progress,
+	* 		part of channels may be one step ahead. Staging of slew rates
+	* 		(RATE_LIMITER_BANK_STAGE_EN) is not available, as pending sets are
+	* 		not persisted. Bank is released with "rate_limiter_bank_deinit()".
+	*
+	* @param[out]  	p_bank			- Pointer to rate limiter bank
+	* @param[in]  	p_path			- Path of backing file
+	* @param[in]  	num_of_ch		- Number of channels
+	* @param[in]  	rise_rate		- Rising slew rate
+	* @param[in]  	fall_rate		- Falling slew rate
+	* @param[in]  	dt				- Update (period) time
+	* @param[out]  	p_is_resumed	- True when state was resumed from file, may be NULL
+	* @return       status			- Either OK or Error
+	*/
+	////////////////////////////////////////////////////////////////////////////////
+	rate_limiter_status_t rate_limiter_bank_init_mapped(p_rate_limiter_bank_t * p_bank, const char * const p_path, const uint32_t num_of_ch, const float32_t rise_rate, const float32_t fall_rate, const float32_t dt, bool * const p_is_resumed)
+	{
+		rate_limiter_status_t 				status 		= eRATE_LIMITER_ERROR;
+		rate_limiter_snapshot_header_t *	p_header	= NULL;
+		struct stat							file_stat;
+		void *								p_map		= MAP_FAILED;
+		size_t								map_size	= 0;
+		int									fd			= -1;
+		bool								is_resumed	= false;
+
+		if 	(	( NULL != p_bank )
+			&&	( NULL != p_path )
+			&&	( num_of_ch > 0U )
+			&& 	( dt > 0.0f ))
+		{
+			map_size = (size_t) rate_limiter_bank_calc_snapshot_size( rate_limiter_bank_calc_stride( num_of_ch ));
+
+			fd = open( p_path, ( O_RDWR | O_CREAT ), 0644 );
+
+			// Single user of file at a time
+			if 	(	( fd >= 0 )
+				&&	( 0 == flock( fd, ( LOCK_EX | LOCK_NB )))
+				&&	( 0 == fstat( fd, &file_stat )))
+			{
+				// Existing bank
+				if ( (uint64_t) file_stat.st_size == map_size )
+				{
+					is_resumed = true;
+					status = eRATE_LIMITER_OK;
+				}
+
+				// New bank
+				else if ( 0 == file_stat.st_size )
+				{
+					if ( 0 == ftruncate( fd, (off_t) map_size ))
+					{
+						status = eRATE_LIMITER_OK;
+					}
+				}
+
+				// Other file
+				else
+				{
+					status = eRATE_LIMITER_ERROR;
+				}
+			}
+
+			if ( eRATE_LIMITER_OK == status )
+			{
+				p_map = mmap( NULL, map_size, ( PROT_READ | PROT_WRITE ), MAP_SHARED, fd, 0 );
+
+				if ( MAP_FAILED == p_map )
+				{
+					status = eRATE_LIMITER_ERROR;
+				}
+			}
+		}
+
+		if ( eRATE_LIMITER_OK == status )
+		{
+			p_header = (rate_limiter_snapshot_header_t*) p_map;
+
+			// Header is written last, thus zero magic marks interrupted creation
+			if 	(	( true == is_resumed )
+				&&	( 0U == p_header->magic ))
+			{
+				is_resumed = false;
+			}
+
+			// Arrays are used in place, thus layout shall match exactly
+			if 	(	( true == is_resumed )
+				&&	(	( false == rate_limiter_snapshot_check_header( p_header, eRATE_LIMITER_SNAPSHOT_BANK, num_of_ch, map_size ))
+					||	( p_header->stride != rate_limiter_bank_calc_stride( num_of_ch ))
+					||	( p_header->size != map_size )))
+			{
+				status = eRATE_LIMITER_ERROR;
+			}
+			else
+			{
+				*p_bank = malloc( sizeof( rate_limiter_bank_t ));
+
+				if ( NULL == *p_bank )
+				{
+					status = eRATE_LIMITER_ERROR;
+				}
+			}
+		}
+
+		if ( eRATE_LIMITER_OK == status )
+		{
+			(*p_bank)->p_mem = NULL;
+			(*p_bank)->p_map = p_map;
+			(*p_bank)->map_size = map_size;
+			(*p_bank)->map_fd = fd;
+
+			if ( true == is_resumed )
+			{
+				rate_limiter_bank_setup( *p_bank, ((uint8_t*) p_map + sizeof( rate_limiter_snapshot_header_t )), NULL, num_of_ch, rise_rate, fall_rate, p_header->dt, false );
+			}
+			else
+			{
+				rate_limiter_bank_setup( *p_bank, ((uint8_t*) p_map + sizeof( rate_limiter_snapshot_header_t )), NULL, num_of_ch, rise_rate, fall_rate, dt, true );
+
+				// Header last, so that interrupted creation is not resumed
+				rate_limiter_snapshot_set_header( p_header, eRATE_LIMITER_SNAPSHOT_BANK, num_of_ch, rate_limiter_bank_calc_stride( num_of_ch ), map_size, dt );
+			}
+
+			if ( NULL != p_is_resumed )
+			{
+				*p_is_resumed = is_resumed;
+			}
+		}
+		else
+		{
+			if ( MAP_FAILED != p_map )
+			{
+				(void) munmap( p_map, map_size );
+			}
+
+			// Closing releases file lock
+			if ( fd >= 0 )
+			{
+				(void) close( fd );
+			}
+		}
+
+		return status;
+	}
+
+	////////////////////////////////////////////////////////////////////////////////
+	/*!
+	* @brief    Write file backed bank state to storage
+	*
+	* @note Blocks until written, thus shall not be called from update
+	* 		thread. Not needed for recovery from process crash.
+	*
+	* @param[in]  	bank		- Pointer to rate limiter bank
+	* @return       status		- Either OK or Error
+	*/
+	////////////////////////////////////////////////////////////////////////////////
+	rate_limiter_status_t rate_limiter_bank_sync(p_rate_limiter_bank_t bank)
+	{
+		rate_limiter_status_t status = eRATE_LIMITER_ERROR;
+
+		// Check for bank, initialization and mapping
+		if ( NULL != bank )
+		{
+			if 	(	( true == bank->is_init )
+				&&	( NULL != bank->p_map ))
+			{
+				if ( 0 == msync( bank->p_map, bank->map_size, MS_SYNC ))
+				{
+					status = eRATE_LIMITER_OK;
+				}
+			}
+		}
+
+		return status;
+	}
+
+#endif
+
+////////////////////////////////////////////////////////////////////////////////
+/*!
+* @brief    Update all channels of rate limiter bank
+*
+* @note User shall provide cyclic call of that function with a value of dt
+* 		given at initialization phase.
+*
+* 		Input and output buffer must hold at least number of channels
+* 		samples and may point to the same location.
+*
+* @param[in]  	bank		- Pointer to rate limiter bank
+* @param[in]  	p_x			- Pointer to input signals, one per channel
+* @param[out]  	p_y			- Pointer to output (slew limited) signals, one per channel
+* @return       status		- Either OK or Error
+*/
+////////////////////////////////////////////////////////////////////////////////
+rate_limiter_status_t rate_limiter_bank_update(p_rate_limiter_bank_t bank, const float32_t * const p_x, float32_t * const p_y)
+{
+	rate_limiter_status_t status = eRATE_LIMITER_ERROR;
+
+	// Check for bank, initialization and buffers
+	if 	(	( NULL != bank )
+		&&	( NULL != p_x )
+		&&	( NULL != p_y ))
+	{
+		if ( true == bank->is_init )
+		{
+			#if ( 1 == RATE_LIMITER_BANK_STAGE_EN )
+				rate_limiter_bank_apply_pending( bank );
+			#endif
+
+			bank->pf_kernel( p_x, p_y, bank->p_x_prev, bank->p_k_rise, bank->p_k_fall, bank->num_of_ch );
+
+			status = eRATE_LIMITER_OK;
+		}
+	}
+
+	return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/*!
+* @brief    Update range of channels of rate limiter bank
+*
+* @note For splitting bank update between threads. Disjoint ranges can be
+* 		updated concurrently. Ranges obtained with
+* 		"rate_limiter_bank_get_partition()" start on aligned block, thus
+* 		threads never write to the same cache line of bank state.
+*
+* 		Input and output buffers are indexed by channel, same as with
+* 		"rate_limiter_bank_update()".
+*
+* @param[in]  	bank		- Pointer to rate limiter bank
+* @param[in]  	p_x			- Pointer to input signals, one per channel
+* @param[out]  	p_y			- Pointer to output (slew limited) signals, one per channel
+* @param[in]  	first_ch	- First channel of range
+* @param[in]  	num_of_ch	- Number of channels in range
+* @return       status		- Either OK or Error
+*/
+////////////////////////////////////////////////////////////////////////////////
+rate_limiter_status_t rate_limiter_bank_update_range(p_rate_limiter_bank_t bank, const float32_t * const p_x, float32_t * const p_y, const uint32_t first_ch, const uint32_t num_of_ch)
+{
+	rate_limiter_status_t status = eRATE_LIMITER_ERROR;
+
+	// Check for bank, initialization, buffers and range
+	if 	(	( NULL != bank )
+		&&	( NULL != p_x )
+		&&	( NULL != p_y ))
+	{
+		if 	(	( true == bank->is_init )
+			&&	( first_ch <= bank->num_of_ch )
+			&&	( num_of_ch <= ( bank->num_of_ch - first_ch )))
+		{
+			bank->pf_kernel( &p_x[first_ch], &p_y[first_ch], &bank->p_x_prev[first_ch], &bank->p_k_rise[first_ch], &bank->p_k_fall[first_ch], num_of_ch );
+
+			status = eRATE_LIMITER_OK;
+		}
+	}
+
+	return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/*!
+* @brief    Get range of channels of bank partition
+*
+* @note Bank is split into num_of_parts nearly equal ranges, each starting
+* 		on RATE_LIMITER_BANK_ALIGN boundary of bank state. Trailing parts
+* 		can be empty when bank has only few channels.
+*
+* @param[in]  	bank			- Pointer to rate limiter bank
+* @param[in]  	part			- Partition index
+* @param[in]  	num_of_parts	- Number of partitions
+* @param[out]  	p_first_ch		- First channel of partition
+* @param[out]  	p_num_of_ch		- Number of channels in partition
+* @return       status			- Either OK or Error
+*/
+////////////////////////////////////////////////////////////////////////////////
+rate_limiter_status_t rate_limiter_bank_get_partition(p_rate_limiter_bank_t bank, const uint32_t part, const uint32_t num_of_parts, uint32_t * const p_first_ch, uint32_t * const p_num_of_ch)
+{
+	rate_limiter_status_t 	status 	= eRATE_LIMITER_ERROR;
+	uint32_t				chunk	= 0;
+	uint64_t				first	= 0;
+
+	// Check for bank, initialization and partition
+	if 	(	( NULL != bank )
+		&&	( NULL != p_first_ch )
+		&&	( NULL != p_num_of_ch ))
+	{
+		if 	(	( true == bank->is_init )
+			&&	( part < num_of_parts ))
+		{
+			// Channels per partition, rounded up to whole aligned blocks
+			chunk = (( bank->num_of_ch + num_of_parts - 1U ) / num_of_parts );
+			chunk = (( chunk + RATE_LIMITER_BANK_CH_PER_ALIGN - 1U ) / RATE_LIMITER_BANK_CH_PER_ALIGN ) * RATE_LIMITER_BANK_CH_PER_ALIGN;
+
+			first = ((uint64_t) part * chunk );
+
+			if ( first < bank->num_of_ch )
+			{
+				*p_first_ch = (uint32_t) first;
+				*p_num_of_ch = (( bank->num_of_ch - *p_first_ch ) < chunk ) ? ( bank->num_of_ch - *p_first_ch ) : chunk;
+			}
+			else
+			{
+				*p_first_ch = bank->num_of_ch;
+				*p_num_of_ch = 0U;
+			}
+
+			status = eRATE_LIMITER_OK;
+		}
+	}
+
+	return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/*!
+* @brief    Advance all channels of rate limiter bank for multiple steps
+*
+* @note Equivalent to calling "rate_limiter_bank_update()" n_steps times
+* 		with the same inputs, but computed in a single pass. See
+* 		"rate_limiter_advance()" for details.
+*
+* @param[in]  	bank		- Pointer to rate limiter bank
+* @param[in]  	p_x			- Pointer to input signals, one per channel
+* @param[out]  	p_y			- Pointer to output (slew limited) signals, one per channel
+* @param[in]  	n_steps		- Number of update periods to advance
+* @return       status		- Either OK or Error
+*/
+////////////////////////////////////////////////////////////////////////////////
+rate_limiter_status_t rate_limiter_bank_advance(p_rate_limiter_bank_t bank, const float32_t * const p_x, float32_t * const p_y, const uint32_t n_steps)
+{
+	rate_limiter_status_t 	status 	= eRATE_LIMITER_ERROR;
+	uint32_t				ch		= 0;
+
+	// Check for bank, initialization and buffers
+	if 	(	( NULL != bank )
+		&&	( NULL != p_x )
+		&&	( NULL != p_y ))
+	{
+		if ( true == bank->is_init )
+		{
+			#if ( 1 == RATE_LIMITER_BANK_STAGE_EN )
+				rate_limiter_bank_apply_pending( bank );
+			#endif
+
+			for ( ch = 0; ch < bank->num_of_ch; ch++ )
+			{
+				bank->p_x_prev[ch] = rate_limiter_limit_n( p_x[ch], bank->p_x_prev[ch], bank->p_k_rise[ch], bank->p_k_fall[ch], n_steps );
+				p_y[ch] = bank->p_x_prev[ch];
+			}
+
+			status = eRATE_LIMITER_OK;
+		}
+	}
+
+	return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/*!
+* @brief    Set target input of single bank channel
+*
+* @note Used together with "rate_limiter_bank_update_active()". Channel is
+* 		marked active when target differs from its current output.
+*
+* 		Target mode and full bank update ("rate_limiter_bank_update()",
+* 		"rate_limiter_bank_advance()") shall not be mixed on the same bank.
+*
+* @param[in]  	bank		- Pointer to rate limiter bank
+* @param[in]  	ch			- Channel index
+* @param[in]  	x			- Target input signal
+* @return       status		- Either OK or Error
+*/
+////////////////////////////////////////////////////////////////////////////////
+rate_limiter_status_t rate_limiter_bank_set_target(p_rate_limiter_bank_t bank, const uint32_t ch, const float32_t x)
+{
+	rate_limiter_status_t status = eRATE_LIMITER_ERROR;
+
+	// Check for bank, initialization and channel
+	if ( NULL != bank )
+	{
+		if 	(	( true == bank->is_init )
+			&&	( ch < bank->num_of_ch ))
+		{
+			bank->p_x_target[ch] = x;
+
+			if ( x != bank->p_x_prev[ch] )
+			{
+				bank->p_active[ ch / RATE_LIMITER_BANK_CH_PER_WORD ] |= ( 1UL << ( ch % RATE_LIMITER_BANK_CH_PER_WORD ));
+			}
+
+			status = eRATE_LIMITER_OK;
+		}
+	}
+
+	return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/*!
+* @brief    Update active channels of rate limiter bank
+*
+* @note Only channels that are not yet settled on their target are
+* 		updated, by walking set bits of active bitmap. Channel is cleared
+* 		from active bitmap once its output reaches the target. Cost of
+* 		update scales with number of ramping channels.
+*
+* 		Outputs of all channels are available with
+* 		"rate_limiter_bank_get_outputs()".
+*
+* @param[in]  	bank		- Pointer to rate limiter bank
+* @return       status		- Either OK or Error
+*/
+////////////////////////////////////////////////////////////////////////////////
+rate_limiter_status_t rate_limiter_bank_update_active(p_rate_limiter_bank_t bank)
+{
+	rate_limiter_status_t status = eRATE_LIMITER_ERROR;
+
+	// Check for bank and initialization
+	if ( NULL != bank )
+	{
+		if ( true == bank->is_init )
+		{
+			#if ( 1 == RATE_LIMITER_BANK_STAGE_EN )
+				rate_limiter_bank_apply_pending( bank );
+			#endif
+
+			rate_limiter_bank_update_active_words( bank, 0U, (( bank->num_of_ch + RATE_LIMITER_BANK_CH_PER_WORD - 1U ) / RATE_LIMITER_BANK_CH_PER_WORD ));
+
+			status = eRATE_LIMITER_OK;
+		}
+	}
+
+	return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/*!
+* @brief    Update active channels in range of rate limiter bank
+*
+* @note Same as "rate_limiter_bank_update_active()" limited to range of
+* 		channels, for splitting target mode update between threads. Range
+* 		shall start and end on multiple of 32 channels (one bitmap word),
+* 		except at the end of bank.
+*
+* @param[in]  	bank		- Pointer to rate limiter bank
+* @param[in]  	first_ch	- First channel of range
+* @param[in]  	num_of_ch	- Number of channels in range
+* @return       status		- Either OK or Error
+*/
+////////////////////////////////////////////////////////////////////////////////
+rate_limiter_status_t rate_limiter_bank_update_active_range(p_rate_limiter_bank_t bank, const uint32_t first_ch, const uint32_t num_of_ch)
+{
+	rate_limiter_status_t 	status 	= eRATE_LIMITER_ERROR;
+	uint32_t				end_ch	= 0;
+
+	// Check for bank, initialization and range
+	if ( NULL != bank )
+	{
+		if 	(	( true == bank->is_init )
+			&&	( first_ch <= bank->num_of_ch )
+			&&	( num_of_ch <= ( bank->num_of_ch - first_ch )))
+		{
+			end_ch = ( first_ch + num_of_ch );
+
+			// Range shall cover whole bitmap words
+			if 	(	( 0U == ( first_ch % RATE_LIMITER_BANK_CH_PER_WORD ))
+				&&	(	( 0U == ( end_ch % RATE_LIMITER_BANK_CH_PER_WORD ))
+					||	( end_ch == bank->num_of_ch )))
+			{
+				rate_limiter_bank_update_active_words( bank, ( first_ch / RATE_LIMITER_BANK_CH_PER_WORD ), (( end_ch + RATE_LIMITER_BANK_CH_PER_WORD - 1U ) / RATE_LIMITER_BANK_CH_PER_WORD ));
+
+				status = eRATE_LIMITER_OK;
+			}
+		}
+	}
+
+	return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/*!
+* @brief    Get outputs of all bank channels
+*
+* @note Outputs are valid until next update of bank.
+*
+* @param[in]  	bank		- Pointer to rate limiter bank
+* @return       p_y			- Pointer to outputs, one per channel, NULL on error
+*/
+////////////////////////////////////////////////////////////////////////////////
+const float32_t * rate_limiter_bank_get_outputs(p_rate_limiter_bank_t bank)
+{
+	const float32_t * p_y = NULL;
+
+	if ( NULL != bank )
+	{
+		if ( true == bank->is_init )
+		{
+			p_y = bank->p_x_prev;
+		}
+	}
+
+	return p_y;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/*!
+* @brief    Get number of active (not settled) bank channels
+*
+* @param[in]  	bank			- Pointer to rate limiter bank
+* @return       num_of_active	- Number of active channels
+*/
+////////////////////////////////////////////////////////////////////////////////
+uint32_t rate_limiter_bank_get_num_of_active(p_rate_limiter_bank_t bank)
+{
+	uint32_t num_of_active 	= 0;
+	uint32_t word			= 0;
+
+	if ( NULL != bank )
+	{
+		if ( true == bank->is_init )
+		{
+			for ( word = 0; word < (( bank->num_of_ch + RATE_LIMITER_BANK_CH_PER_WORD - 1U ) / RATE_LIMITER_BANK_CH_PER_WORD ); word++ )
+			{
+				num_of_active += rate_limiter_bank_popcount( bank->p_active[word] );
+			}
+		}
+	}
+
+	return num_of_active;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/*!
+* @brief    Get success initialization flag
+*
+* @param[in]  	bank		- Pointer to rate limiter bank
+* @return       is_init		- Success initialization flag
+*/
+////////////////////////////////////////////////////////////////////////////////
+bool rate_limiter_bank_is_init(p_rate_limiter_bank_t bank)
+{
+	bool is_init = false;
+
+	if ( NULL != bank )
+	{
+		is_init = bank->is_init;
+	}
+
+	return is_init;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/*!
+* @brief    Get number of channels in bank
+*
+* @param[in]  	bank		- Pointer to rate limiter bank
+* @return       num_of_ch	- Number of channels
+*/
+////////////////////////////////////////////////////////////////////////////////
+uint32_t rate_limiter_bank_get_num_of_ch(p_rate_limiter_bank_t bank)
+{
+	uint32_t num_of_ch = 0;
+
+	if ( NULL != bank )
+	{
+		if ( true == bank->is_init )
+		{
+			num_of_ch = bank->num_of_ch;
+		}
+	}
+
+	return num_of_ch;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/*!
+* @brief    Change slew rate of single bank channel
+*
+* @note Slew rate limit has same logic as with initialization function.
+* 		Change takes effect immediately, thus shall be called from update
+* 		thread.
+*
+* 		With RATE_LIMITER_BANK_STAGE_EN it is staged and committed at once
+* 		(together with channels staged before), takes effect at next block
+* 		boundary and shall be called from staging thread. File backed bank
+* 		is changed immediately.
+*
+* @param[in]  	bank		- Pointer to rate limiter bank
+* @param[in]  	ch			- Channel index
+* @param[in]  	rise_rate	- Rising slew rate
+* @param[in]  	fall_rate	- Falling slew rate
+* @return       status		- Either OK or Error
+*/
+////////////////////////////////////////////////////////////////////////////////
+rate_limiter_status_t rate_limiter_bank_change_rate(p_rate_limiter_bank_t bank, const uint32_t ch, const float32_t rise_rate, const float32_t fall_rate)
+{
+	rate_limiter_status_t 	status 		= eRATE_LIMITER_ERROR;
+	float32_t *				p_k_rise	= NULL;
+	float32_t *				p_k_fall	= NULL;
+
+	// Check for bank, initialization and channel
+	if ( NULL != bank )
+	{
+		if 	(	( true == bank->is_init )
+			&&	( ch < bank->num_of_ch ))
+		{
+			rate_limiter_bank_begin_change( bank, &p_k_rise, &p_k_fall );
+
+			p_k_rise[ch] = rate_limiter_calc_rate_factor( bank->dt, rise_rate );
+			p_k_fall[ch] = rate_limiter_calc_rate_factor( bank->dt, fall_rate );
+
+			rate_limiter_bank_end_change( bank );
+
+			status = eRATE_LIMITER_OK;
+		}
+	}
+
+	return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/*!
+* @brief    Change slew rates of listed bank channels
+*
+* @note Bulk form of "rate_limiter_bank_change_rate()", bank and list are
+* 		checked once. Whole list is checked before any change, so on
+* 		invalid index bank is left untouched. Takes effect same as single
+* 		channel change.
+*
+* @param[in]  	bank		- Pointer to rate limiter bank
+* @param[in]  	p_idx		- Pointer to channel indices
+* @param[in]  	p_rise		- Pointer to rising slew rates, one per index
+* @param[in]  	p_fall		- Pointer to falling slew rates, one per index
+* @param[in]  	num			- Number of indices
+* @return       status		- Either OK or Error
+*/
+////////////////////////////////////////////////////////////////////////////////
+rate_limiter_status_t rate_limiter_bank_change_rates(p_rate_limiter_bank_t bank, const uint32_t * const p_idx, const float32_t * const p_rise, const float32_t * const p_fall, const uint32_t num)
+{
+	rate_limiter_status_t 	status 		= eRATE_LIMITER_ERROR;
+	float32_t *				p_k_rise	= NULL;
+	float32_t *				p_k_fall	= NULL;
+
+	// Check for bank, initialization and list
+	if 	(	( NULL != bank )
+		&&	( NULL != p_idx )
+		&&	( NULL != p_rise )
+		&&	( NULL != p_fall ))
+	{
+		if 	(	( true == bank->is_init )
+			&&	( true == rate_limiter_bank_check_idx( p_idx, num, bank->num_of_ch )))
+		{
+			rate_limiter_bank_begin_change( bank, &p_k_rise, &p_k_fall );
+			rate_limiter_bank_scatter_factors( bank->dt, p_idx, p_rise, p_fall, p_k_rise, p_k_fall, num );
+			rate_limiter_bank_end_change( bank );
+
+			status = eRATE_LIMITER_OK;
+		}
+	}
+
+	return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/*!
+* @brief    Change slew rates of all bank channels
+*
+* @note Dense form of "rate_limiter_bank_change_rates()", takes effect
+* 		same as single channel change.
+*
+* @param[in]  	bank		- Pointer to rate limiter bank
+* @param[in]  	p_rise		- Pointer to rising slew rates, one per channel
+* @param[in]  	p_fall		- Pointer to falling slew rates, one per channel
+* @return       status		- Either OK or Error
+*/
+////////////////////////////////////////////////////////////////////////////////
+rate_limiter_status_t rate_limiter_bank_change_rates_all(p_rate_limiter_bank_t bank, const float32_t * const p_rise, const float32_t * const p_fall)
+{
+	rate_limiter_status_t 	status 		= eRATE_LIMITER_ERROR;
+	float32_t *				p_k_rise	= NULL;
+	float32_t *				p_k_fall	= NULL;
+
+	// Check for bank, initialization and rates
+	if 	(	( NULL != bank )
+		&&	( NULL != p_rise )
+		&&	( NULL != p_fall ))
+	{
+		if ( true == bank->is_init )
+		{
+			rate_limiter_bank_begin_change( bank, &p_k_rise, &p_k_fall );
+			rate_limiter_bank_calc_factors( bank->dt, p_rise, p_k_rise, bank->num_of_ch );
+			rate_limiter_bank_calc_factors( bank->dt, p_fall, p_k_fall, bank->num_of_ch );
+			rate_limiter_bank_end_change( bank );
+
+			status = eRATE_LIMITER_OK;
+		}
+	}
+
+	return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/*!
+* @brief    Get size of bank snapshot
+*
+* @param[in]  	bank		- Pointer to rate limiter bank
+* @return       size		- Snapshot size in bytes, 0 when bank is not initialized
+*/
+////////////////////////////////////////////////////////////////////////////////
+size_t rate_limiter_bank_get_snapshot_size(p_rate_limiter_bank_t bank)
+{
+	size_t size = 0U;
+
+	if ( true == rate_limiter_bank_is_init( bank ))
+	{
+		size = (size_t) rate_limiter_bank_calc_snapshot_size( rate_limiter_bank_calc_stride( bank->num_of_ch ));
+	}
+
+	return size;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/*!
+* @brief    Take snapshot of rate limiter bank state
+*
+* @note Snapshot is flat buffer of "rate_limiter_bank_get_snapshot_size()"
+* 		bytes, that can be written out with single write(). Arrays are
+* 		copied whole, so cost is bound by memory bandwidth. Shall not run
+* 		concurrently with update.
+*
+* @param[in]  	bank		- Pointer to rate limiter bank
+* @param[out]  	p_buf		- Pointer to snapshot buffer
+* @param[in]  	size		- Size of snapshot buffer in bytes
+* @return       status		- Either OK or Error
+*/
+////////////////////////////////////////////////////////////////////////////////
+rate_limiter_status_t rate_limiter_bank_snapshot(p_rate_limiter_bank_t bank, void * const p_buf, const size_t size)
+{
+	rate_limiter_status_t 			status 		= eRATE_LIMITER_ERROR;
+	rate_limiter_snapshot_header_t	header;
+	uint8_t *						p_dst		= (uint8_t*) p_buf;
+	uint32_t						stride		= 0;
+	uint64_t						snap_size	= 0;
+	size_t							array_size	= 0;
+
+	// Check for bank, initialization and buffer
+	if 	(	( NULL != bank )
+		&&	( NULL != p_buf ))
+	{
+		if ( true == bank->is_init )
+		{
+			stride = rate_limiter_bank_calc_stride( bank->num_of_ch );
+			snap_size = rate_limiter_bank_calc_snapshot_size( stride );
+			array_size = ( stride * sizeof( float32_t ));
+
+			if ( size >= snap_size )
+			{
+				// Buffer may be unaligned
+				rate_limiter_snapshot_set_header( &header, eRATE_LIMITER_SNAPSHOT_BANK, bank->num_of_ch, stride, snap_size, bank->dt );
+				memcpy( p_dst, &header, sizeof( rate_limiter_snapshot_header_t ));
+				p_dst += sizeof( rate_limiter_snapshot_header_t );
+
+				memcpy( p_dst, bank->p_x_prev, array_size );
+				p_dst += array_size;
+				memcpy( p_dst, bank->p_k_rise, array_size );
+				p_dst += array_size;
+				memcpy( p_dst, bank->p_k_fall, array_size );
+				p_dst += array_size;
+				memcpy( p_dst, bank->p_x_target, array_size );
+				p_dst += array_size;
+				memcpy( p_dst, bank->p_active, (( stride + RATE_LIMITER_BANK_CH_PER_WORD - 1U ) / RATE_LIMITER_BANK_CH_PER_WORD ) * sizeof( uint32_t ));
+
+				status = eRATE_LIMITER_OK;
+			}
+		}
+	}
+
+	return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/*!
+* @brief    Restore rate limiter bank state from snapshot
+*
+* @note Bank shall be initialized with same number of channels. Period,
+* 		slew rate factors, previous outputs and targets are taken from
+* 		snapshot, also when it was taken with other RATE_LIMITER_BANK_ALIGN.
+* 		On invalid snapshot bank is left untouched. Shall not run
+* 		concurrently with update.
+*
+* 		With RATE_LIMITER_BANK_STAGE_EN rate sets are reset as after init,
+* 		staged and published rates that were not applied yet are dropped,
+* 		thus it shall not run concurrently with staging either.
+*
+* @param[in]  	bank		- Pointer to rate limiter bank
+* @param[in]  	p_buf		- Pointer to snapshot buffer
+* @param[in]  	size		- Size of snapshot buffer in bytes
+* @return       status		- Either OK or Error
+*/
+////////////////////////////////////////////////////////////////////////////////
+rate_limiter_status_t rate_limiter_bank_restore(p_rate_limiter_bank_t bank, const void * const p_buf, const size_t size)
+{
+	rate_limiter_status_t 			status 		= eRATE_LIMITER_ERROR;
+	rate_limiter_snapshot_header_t	header;
+	const uint8_t *					p_src		= (const uint8_t*) p_buf;
+	size_t							array_size	= 0;
+	size_t							copy_size	= 0;
+
+	// Check for bank, initialization and buffer
+	if 	(	( NULL != bank )
+		&&	( NULL != p_buf )
+		&&	( size >= sizeof( rate_limiter_snapshot_header_t )))
+	{
+		// Buffer may be unaligned
+		memcpy( &header, p_src, sizeof( rate_limiter_snapshot_header_t ));
+
+		if 	(	( true == bank->is_init )
+			&&	( true == rate_limiter_snapshot_check_header( &header, eRATE_LIMITER_SNAPSHOT_BANK, bank->num_of_ch, size ))
+			&&	( header.size == rate_limiter_bank_calc_snapshot_size( header.stride )))
+		{
+			p_src += sizeof( rate_limiter_snapshot_header_t );
+			array_size = ( header.stride * sizeof( float32_t ));
+			copy_size = ( bank->num_of_ch * sizeof( float32_t ));
+
+			#if ( 1 == RATE_LIMITER_BANK_STAGE_EN )
+				rate_limiter_bank_reset_sets( bank );
+			#endif
+
+			memcpy( bank->p_x_prev, p_src, copy_size );
+			p_src += array_size;
+			memcpy( bank->p_k_rise, p_src, copy_size );
+			p_src += array_size;
+			memcpy( bank->p_k_fall, p_src, copy_size );
+			p_src += array_size;
+			memcpy( bank->p_x_target, p_src, copy_size );
+			p_src += array_size;
+			memcpy( bank->p_active, p_src, (( bank->num_of_ch + RATE_LIMITER_BANK_CH_PER_WORD - 1U ) / RATE_LIMITER_BANK_CH_PER_WORD ) * sizeof( uint32_t ));
+
+			bank->dt = header.dt;
+
+			#if ( 1 == RATE_LIMITER_BANK_MMAP_EN )
+				// Keep period of file backed bank
+				if ( NULL != bank->p_map )
+				{
+					((rate_limiter_snapshot_header_t*) bank->p_map )->dt = header.dt;
+				}
+			#endif
+
+			status = eRATE_LIMITER_OK;
+		}
+	}
+
+	return status;
+}
+
+#if ( 1 == RATE_LIMITER_BANK_STAGE_EN )
+
+	////////////////////////////////////////////////////////////////////////////////
+	/*!
+	* @brief    Stage slew rate of single bank channel
+	*
+	* @note Rate is written to pending factor set, update keeps using active
+	* 		set until "rate_limiter_bank_commit_rates()" and next block
+	* 		boundary. First stage after commit copies last published set to
+	* 		pending set. Rate sets are triple buffered, so staging never waits
+	* 		for update thread to apply previous commit. Staging and commit
+	* 		shall be done from single thread.
+	*
+	* @param[in]  	bank		- Pointer to rate limiter bank
+	* @param[in]  	ch			- Channel index
+	* @param[in]  	rise_rate	- Rising slew rate
+	* @param[in]  	fall_rate	- Falling slew rate
+	* @return       status		- Either OK or Error
+	*/
+	////////////////////////////////////////////////////////////////////////////////
+	rate_limiter_status_t rate_limiter_bank_stage_rate(p_rate_limiter_bank_t bank, const uint32_t ch, const float32_t rise_rate, const float32_t fall_rate)
+	{
+		rate_limiter_status_t 	status 	= eRATE_LIMITER_ERROR;
+		uint32_t				set		= 0;
+
+		// Check for bank, initialization and channel
+		if ( NULL != bank )
+		{
+			if 	(	( true == bank->is_init )
+				&&	( ch < bank->num_of_ch ))
+			{
+				if ( true == rate_limiter_bank_begin_stage( bank ))
+				{
+					set = bank->stage_set;
+
+					bank->p_k_rise_set[set][ch] = rate_limiter_calc_rate_factor( bank->dt, rise_rate );
+					bank->p_k_fall_set[set][ch] = rate_limiter_calc_rate_factor( bank->dt, fall_rate );
+
+					status = eRATE_LIMITER_OK;
+				}
+			}
+		}
+
+		return status;
+	}
+
+	////////////////////////////////////////////////////////////////////////////////
+	/*!
+	* @brief    Stage slew rates of listed bank channels
+	*
+	* @note Bulk form of "rate_limiter_bank_stage_rate()". On invalid index
+	* 		nothing is staged.
+	*
+	* @param[in]  	bank		- Pointer to rate limiter bank
+	* @param[in]  	p_idx		- Pointer to channel indices
+	* @param[in]  	p_rise		- Pointer to rising slew rates, one per index
+	* @param[in]  	p_fall		- Pointer to falling slew rates, one per index
+	* @param[in]  	num			- Number of indices
+	* @return       status		- Either OK or Error
+	*/
+	////////////////////////////////////////////////////////////////////////////////
+	rate_limiter_status_t rate_limiter_bank_stage_rates(p_rate_limiter_bank_t bank, const uint32_t * const p_idx, const float32_t * const p_rise, const float32_t * const p_fall, const uint32_t num)
+	{
+		rate_limiter_status_t 	status 	= eRATE_LIMITER_ERROR;
+		uint32_t				set		= 0;
+
+		// Check for bank, initialization and list
+		if 	(	( NULL != bank )
+			&&	( NULL != p_idx )
+			&&	( NULL != p_rise )
+			&&	( NULL != p_fall ))
+		{
+			if 	(	( true == bank->is_init )
+				&&	( true == rate_limiter_bank_check_idx( p_idx, num, bank->num_of_ch )))
+			{
+				if ( true == rate_limiter_bank_begin_stage( bank ))
+				{
+					set = bank->stage_set;
+
+					rate_limiter_bank_scatter_factors( bank->dt, p_idx, p_rise, p_fall, bank->p_k_rise_set[set], bank->p_k_fall_set[set], num );
+
+					status = eRATE_LIMITER_OK;
+				}
+			}
+		}
+
+		return status;
+	}
+
+	////////////////////////////////////////////////////////////////////////////////
+	/*!
+	* @brief    Stage slew rates of all bank channels
+	*
+	* @note Dense form of "rate_limiter_bank_stage_rates()".
+	*
+	* @param[in]  	bank		- Pointer to rate limiter bank
+	* @param[in]  	p_rise		- Pointer to rising slew rates, one per channel
+	* @param[in]  	p_fall		- Pointer to falling slew rates, one per channel
+	* @return       status		- Either OK or Error
+	*/
+	////////////////////////////////////////////////////////////////////////////////
+	rate_limiter_status_t rate_limiter_bank_stage_rates_all(p_rate_limiter_bank_t bank, const float32_t * const p_rise, const float32_t * const p_fall)
+	{
+		rate_limiter_status_t 	status 	= eRATE_LIMITER_ERROR;
+		uint32_t				set		= 0;
+
+		// Check for bank, initialization and rates
+		if 	(	( NULL != bank )
+			&&	( NULL != p_rise )
+			&&	( NULL != p_fall ))
+		{
+			if ( true == bank->is_init )
+			{
+				if ( true == rate_limiter_bank_begin_stage( bank ))
+				{
+					set = bank->stage_set;
+
+					rate_limiter_bank_calc_factors( bank->dt, p_rise, bank->p_k_rise_set[set], bank->num_of_ch );
+					rate_limiter_bank_calc_factors( bank->dt, p_fall, bank->p_k_fall_set[set], bank->num_of_ch );
+
+					status = eRATE_LIMITER_OK;
+				}
+			}
+		}
+
+		return status;
+	}
+
+	////////////////////////////////////////////////////////////////////////////////
+	/*!
+	* @brief    Publish staged slew rates of bank
+	*
+	* @note Single atomic exchange. All staged channels switch together at
+	* 		next "rate_limiter_bank_update()", "rate_limiter_bank_advance()",
+	* 		"rate_limiter_bank_update_active()" or "rate_limiter_bank_apply_rates()".
+	* 		Commit that was not applied yet is replaced, update thread then
+	* 		switches directly to the latest one, which includes it.
+	*
+	* @param[in]  	bank		- Pointer to rate limiter bank
+	* @return       status		- Either OK or Error
+	*/
+	////////////////////////////////////////////////////////////////////////////////
+	rate_limiter_status_t rate_limiter_bank_commit_rates(p_rate_limiter_bank_t bank)
+	{
+		rate_limiter_status_t status = eRATE_LIMITER_ERROR;
+
+		// Check for bank and initialization
+		if ( NULL != bank )
+		{
+			if ( true == bank->is_init )
+			{
+				rate_limiter_bank_publish( bank );
+
+				status = eRATE_LIMITER_OK;
+			}
+		}
+
+		return status;
+	}
+
+	////////////////////////////////////////////////////////////////////////////////
+	/*!
+	* @brief    Apply published slew rates of bank
+	*
+	* @note Whole bank updates apply published rates by themselves. Range
+	* 		updates do not, so when bank is split between threads call it
+	* 		once per tick before ranges are updated.
+	*
+	* @param[in]  	bank		- Pointer to rate limiter bank
+	* @return       status		- Either OK or Error
+	*/
+	////////////////////////////////////////////////////////////////////////////////
+	rate_limiter_status_t rate_limiter_bank_apply_rates(p_rate_limiter_bank_t bank)
+	{
+		rate_limiter_status_t status = eRATE_LIMITER_ERROR;
+
+		// Check for bank and initialization
+		if ( NULL != bank )
+		{
+			if ( true == bank->is_init )
+			{
+				rate_limiter_bank_apply_pending( bank );
+
+				status = eRATE_LIMITER_OK;
+			}
+		}
+
+		return status;
+	}
+
+#endif
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+* @} <!-- END GROUP -->
+*/
+////////////////////////////////////////////////////////////////////////////////
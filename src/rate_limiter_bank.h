@@ -0,0 +1,127 @@
+// Copyright (c) 2021 Ziga Miklosic
+// All Rights Reserved
+// This software is under MIT licence (https://opensource.org/licenses/MIT)
+////////////////////////////////////////////////////////////////////////////////
+/**
+*@file      rate_limiter_bank.h
+*@brief     Multi-channel rate limiter bank
+*@author    Ziga Miklosic
+*@date      19.02.2021
+*@version   V1.1.0
+*/
+////////////////////////////////////////////////////////////////////////////////
+/**
+*@addtogroup RATE_LIMITER_BANK_API
+* @{ <!-- BEGIN GROUP -->
+*
+*/
+////////////////////////////////////////////////////////////////////////////////
+
+#ifndef __RATE_LIMITER_BANK_H
+#define __RATE_LIMITER_BANK_H
+
+////////////////////////////////////////////////////////////////////////////////
+// Includes
+////////////////////////////////////////////////////////////////////////////////
+#include "rate_limiter.h"
+
+////////////////////////////////////////////////////////////////////////////////
+// Definitions
+////////////////////////////////////////////////////////////////////////////////
+
+/**
+ * 	Alignment of bank channel arrays in bytes
+ *
+ * @note Shall be power of two and multiple of float32_t size. Default
+ * 		is size of cache line. Can be overridden in "project_config.h".
+ */
+#ifndef RATE_LIMITER_BANK_ALIGN
+	#define RATE_LIMITER_BANK_ALIGN		( 64U )
+#endif
+
+/**
+ * 	Enable hand written SIMD bank kernels with runtime CPU dispatch
+ *
+ * @note Available only on x86 with GCC or Clang, otherwise scalar
+ * 		kernel is used. Can be overridden in "project_config.h".
+ *
+ * 	0 - Disabled
+ * 	1 - Enabled
+ */
+#ifndef RATE_LIMITER_BANK_SIMD_EN
+	#define RATE_LIMITER_BANK_SIMD_EN	( 0 )
+#endif
+
+/**
+ * 	Enable file backed (memory mapped) bank
+ *
+ * @note Requires POSIX mmap. Can be overridden in "project_config.h".
+ *
+ * 	0 - Disabled
+ * 	1 - Enabled
+ */
+#ifndef RATE_LIMITER_BANK_MMAP_EN
+	#define RATE_LIMITER_BANK_MMAP_EN	( 0 )
+#endif
+
+/**
+ * 	Enable staged (triple buffered) bank slew rate changes
+ *
+ * @note Requires C11 lock-free 32-bit atomics. Independent of per instance
+ * 		RATE_LIMITER_ATOMIC_EN. Can be overridden in "project_config.h".
+ *
+ * 	0 - Disabled
+ * 	1 - Enabled
+ */
+#ifndef RATE_LIMITER_BANK_STAGE_EN
+	#define RATE_LIMITER_BANK_STAGE_EN	( 0 )
+#endif
+
+/**
+ * 	Pointer to rate limiter bank
+ */
+typedef struct rate_limiter_bank_s * p_rate_limiter_bank_t;
+
+////////////////////////////////////////////////////////////////////////////////
+// Functions
+////////////////////////////////////////////////////////////////////////////////
+rate_limiter_status_t 	rate_limiter_bank_init			(p_rate_limiter_bank_t * p_bank, const uint32_t num_of_ch, const float32_t rise_rate, const float32_t fall_rate, const float32_t dt);
+rate_limiter_status_t 	rate_limiter_bank_deinit		(p_rate_limiter_bank_t * p_bank);
+rate_limiter_status_t	rate_limiter_bank_update		(p_rate_limiter_bank_t bank, const float32_t * const p_x, float32_t * const p_y);
+rate_limiter_status_t	rate_limiter_bank_update_range	(p_rate_limiter_bank_t bank, const float32_t * const p_x, float32_t * const p_y, const uint32_t first_ch, const uint32_t num_of_ch);
+rate_limiter_status_t	rate_limiter_bank_get_partition	(p_rate_limiter_bank_t bank, const uint32_t part, const uint32_t num_of_parts, uint32_t * const p_first_ch, uint32_t * const p_num_of_ch);
+rate_limiter_status_t	rate_limiter_bank_advance		(p_rate_limiter_bank_t bank, const float32_t * const p_x, float32_t * const p_y, const uint32_t n_steps);
+rate_limiter_status_t	rate_limiter_bank_set_target	(p_rate_limiter_bank_t bank, const uint32_t ch, const float32_t x);
+rate_limiter_status_t	rate_limiter_bank_update_active	(p_rate_limiter_bank_t bank);
+rate_limiter_status_t	rate_limiter_bank_update_active_range(p_rate_limiter_bank_t bank, const uint32_t first_ch, const uint32_t num_of_ch);
+const float32_t *		rate_limiter_bank_get_outputs	(p_rate_limiter_bank_t bank);
+uint32_t				rate_limiter_bank_get_num_of_active(p_rate_limiter_bank_t bank);
+bool					rate_limiter_bank_is_init		(p_rate_limiter_bank_t bank);
+uint32_t				rate_limiter_bank_get_num_of_ch	(p_rate_limiter_bank_t bank);
+rate_limiter_status_t	rate_limiter_bank_change_rate	(p_rate_limiter_bank_t bank, const uint32_t ch, const float32_t rise_rate, const float32_t fall_rate);
+rate_limiter_status_t	rate_limiter_bank_change_rates	(p_rate_limiter_bank_t bank, const uint32_t * const p_idx, const float32_t * const p_rise, const float32_t * const p_fall, const uint32_t num);
+rate_limiter_status_t	rate_limiter_bank_change_rates_all(p_rate_limiter_bank_t bank, const float32_t * const p_rise, const float32_t * const p_fall);
+size_t					rate_limiter_bank_get_snapshot_size(p_rate_limiter_bank_t bank);
+rate_limiter_status_t	rate_limiter_bank_snapshot		(p_rate_limiter_bank_t bank, void * const p_buf, const size_t size);
+rate_limiter_status_t	rate_limiter_bank_restore		(p_rate_limiter_bank_t bank, const void * const p_buf, const size_t size);
+
+#if ( 1 == RATE_LIMITER_BANK_MMAP_EN )
+	rate_limiter_status_t	rate_limiter_bank_init_mapped	(p_rate_limiter_bank_t * p_bank, const char * const p_path, const uint32_t num_of_ch, const float32_t rise_rate, const float32_t fall_rate, const float32_t dt, bool * const p_is_resumed);
+	rate_limiter_status_t	rate_limiter_bank_sync			(p_rate_limiter_bank_t bank);
+#endif
+
+#if ( 1 == RATE_LIMITER_BANK_STAGE_EN )
+	rate_limiter_status_t	rate_limiter_bank_stage_rate	(p_rate_limiter_bank_t bank, const uint32_t ch, const float32_t rise_rate, const float32_t fall_rate);
+	rate_limiter_status_t	rate_limiter_bank_stage_rates	(p_rate_limiter_bank_t bank, const uint32_t * const p_idx, const float32_t * const p_rise, const float32_t * const p_fall, const uint32_t num);
+	rate_limiter_status_t	rate_limiter_bank_stage_rates_all(p_rate_limiter_bank_t bank, const float32_t * const p_rise, const float32_t * const p_fall);
+	rate_limiter_status_t	rate_limiter_bank_commit_rates	(p_rate_limiter_bank_t bank);
+	rate_limiter_status_t	rate_limiter_bank_apply_rates	(p_rate_limiter_bank_t bank);
+#endif
+
+#endif // __RATE_LIMITER_BANK_H
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+* @} <!-- END GROUP -->
+*/
+////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,417 @@
+// Copyright (c) 2021 Ziga Miklosic
+// All Rights Reserved
+// This software is under MIT licence (https://opensource.org/licenses/MIT)
+////////////////////////////////////////////////////////////////////////////////
+/**
+*@file      rate_limiter_bank16.c
+*@brief     Multi-channel rate limiter bank with 16-bit storage
+*@author    Ziga Miklosic
+*@date      19.02.2021
+*@version   V1.1.0
+*
+*@section Description
+*
+*	Variant of rate limiter bank for very large number of low precision
+*	channels. Previous values and rise/fall factors are stored in IEEE
+*	half precision (fp16) or bfloat16 format, together with 16-bit sub-ulp
+*	remainder that is 8 bytes per channel instead of 12, while update
+*	itself is computed in float.
+*
+*	After each update new value is rounded into storage format and output
+*	is that stored value widened back to float. While channel is moving,
+*	value is rounded towards previous position and the rest of change is
+*	kept in remainder with resolution of 2^-15 storage ulp. Thus slew rate
+*	factor smaller than storage resolution at signal level still moves
+*	channel by one ulp once enough change is accumulated, average slew
+*	rate equals requested one and is never exceeded. Factor smaller than
+*	remainder resolution stalls channel. Settled channel holds input
+*	rounded to nearest even.
+*
+*	Fp16 has 11 bits and bf16 8 bits of precision, so this mode suits
+*	signals like set-points of lighting or HVAC, not precise control loops.
+*
+*	With RATE_LIMITER_BANK_SIMD_EN enabled F16C/AVX-512 conversions are
+*	used for fp16 and AVX2 integer rounding for bf16. All kernels give
+*	bit exact results.
+*
+*/
+////////////////////////////////////////////////////////////////////////////////
+/*!
+* @addtogroup RATE_LIMITER_BANK16
+* @{ <!-- BEGIN GROUP -->
+*/
+////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////
+// Includes
+////////////////////////////////////////////////////////////////////////////////
+#include "rate_limiter_bank16.h"
+#include "rate_limiter_kernel.h"
+#include "rate_limiter_simd.h"
+
+
+////////////////////////////////////////////////////////////////////////////////
+// Definitions
+////////////////////////////////////////////////////////////////////////////////
+
+/**
+ * 	Number of channels per aligned array block
+ */
+#define RATE_LIMITER_BANK16_CH_PER_ALIGN		( RATE_LIMITER_BANK_ALIGN / sizeof( uint16_t ))
+
+/**
+ * 	16-bit storage slew rate limiter bank
+ */
+typedef struct rate_limiter_bank16_s
+{
+	uint16_t *						p_x_prev;	/**<Previous values of channels */
+	int16_t *						p_x_res;	/**<Sub-ulp remainders of channels */
+	uint16_t *						p_k_rise;	/**<Rising slew rate factors of channels */
+	uint16_t * 						p_k_fall;	/**<Falling slew rate factors of channels */
+	void *							p_mem;		/**<Allocated memory space of channel arrays */
+	pf_rate_limiter_bank16_kernel_t	pf_kernel;	/**<Update kernel */
+	rate_limiter_bank16_format_t	format;		/**<Storage format */
+	float32_t 						dt;			/**<Period of update */
+	uint32_t						num_of_ch;	/**<Number of channels */
+	bool							is_init;	/**<Rate limiter bank initialization success flag */
+} rate_limiter_bank16_t;
+
+////////////////////////////////////////////////////////////////////////////////
+// Variables
+////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////
+// Function prototypes
+////////////////////////////////////////////////////////////////////////////////
+static uint16_t	rate_limiter_bank16_narrow			(const rate_limiter_bank16_format_t format, const float32_t x);
+static void		rate_limiter_bank16_fp16_kernel		(const float32_t * const p_x, float32_t * const p_y, uint16_t * const p_x_prev, int16_t * const p_x_res, const uint16_t * const p_k_rise, const uint16_t * const p_k_fall, const uint32_t num_of_ch);
+static void		rate_limiter_bank16_bf16_kernel		(const float32_t * const p_x, float32_t * const p_y, uint16_t * const p_x_prev, int16_t * const p_x_res, const uint16_t * const p_k_rise, const uint16_t * const p_k_fall, const uint32_t num_of_ch);
+
+////////////////////////////////////////////////////////////////////////////////
+// Functions
+////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////
+/*!
+* @brief    Convert float to storage format
+*
+* @param[in]  	format		- Storage format
+* @param[in]  	x			- Float value
+* @return       h			- Raw 16-bit value
+*/
+////////////////////////////////////////////////////////////////////////////////
+static uint16_t rate_limiter_bank16_narrow(const rate_limiter_bank16_format_t format, const float32_t x)
+{
+	uint16_t h = 0;
+
+	if ( eRATE_LIMITER_BANK16_BF16 == format )
+	{
+		h = rate_limiter_f32_to_bf16( x );
+	}
+	else
+	{
+		h = rate_limiter_f32_to_fp16( x );
+	}
+
+	return h;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/*!
+* @brief    Bank update kernel, fp16 storage, scalar
+*
+* @param[in]  	p_x			- Pointer to input signals
+* @param[out]  	p_y			- Pointer to output (slew limited) signals
+* @param[in]  	p_x_prev	- Pointer to stored previous values
+* @param[in]  	p_x_res		- Pointer to sub-ulp remainders
+* @param[in]  	p_k_rise	- Pointer to stored rising slew rate factors
+* @param[in]  	p_k_fall	- Pointer to stored falling slew rate factors
+* @param[in]  	num_of_ch	- Number of channels
+* @return       void
+*/
+////////////////////////////////////////////////////////////////////////////////
+static void rate_limiter_bank16_fp16_kernel(const float32_t * const p_x, float32_t * const p_y, uint16_t * const p_x_prev, int16_t * const p_x_res, const uint16_t * const p_k_rise, const uint16_t * const p_k_fall, const uint32_t num_of_ch)
+{
+	uint32_t ch = 0;
+
+	for ( ch = 0; ch < num_of_ch; ch++ )
+	{
+		p_y[ch] = rate_limiter_fp16_limit( p_x[ch], &p_x_prev[ch], &p_x_res[ch], p_k_rise[ch], p_k_fall[ch] );
+	}
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/*!
+* @brief    Bank update kernel, bf16 storage, scalar
+*
+* @param[in]  	p_x			- Pointer to input signals
+* @param[out]  	p_y			- Pointer to output (slew limited) signals
+* @param[in]  	p_x_prev	- Pointer to stored previous values
+* @param[in]  	p_x_res		- Pointer to sub-ulp remainders
+* @param[in]  	p_k_rise	- Pointer to stored rising slew rate factors
+* @param[in]  	p_k_fall	- Pointer to stored falling slew rate factors
+* @param[in]  	num_of_ch	- Number of channels
+* @return       void
+*/
+////////////////////////////////////////////////////////////////////////////////
+static void rate_limiter_bank16_bf16_kernel(const float32_t * const p_x, float32_t * const p_y, uint16_t * const p_x_prev, int16_t * const p_x_res, const uint16_t * const p_k_rise, const uint16_t * const p_k_fall, const uint32_t num_of_ch)
+{
+	uint32_t ch = 0;
+
+	for ( ch = 0; ch < num_of_ch; ch++ )
+	{
+		p_y[ch] = rate_limiter_bf16_limit( p_x[ch], &p_x_prev[ch], &p_x_res[ch], p_k_rise[ch], p_k_fall[ch] );
+	}
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+* @} <!-- END GROUP -->
+*/
+////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*@addtogroup RATE_LIMITER_BANK16_API
+* @{ <!-- BEGIN GROUP -->
+*
+* 	Following function are part or 16-bit storage rate limiter bank API.
+*/
+////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////
+/*!
+* @brief    Initialize 16-bit storage rate limiter bank
+*
+* @note All channels are initialized with the same rising/falling slew
+* 		rate. Slew rate factors are rounded to storage format.
+*
+* @param[out]  	p_bank		- Pointer to 16-bit storage rate limiter bank
+* @param[in]  	num_of_ch	- Number of channels
+* @param[in]  	format		- Storage format
+* @param[in]  	rise_rate	- Rising slew rate
+* @param[in]  	fall_rate	- Falling slew rate
+* @param[in]  	dt			- Update (period) time
+* @return       status		- Either OK or Error
+*/
+////////////////////////////////////////////////////////////////////////////////
+rate_limiter_status_t rate_limiter_bank16_init(p_rate_limiter_bank16_t * p_bank, const uint32_t num_of_ch, const rate_limiter_bank16_format_t format, const float32_t rise_rate, const float32_t fall_rate, const float32_t dt)
+{
+	rate_limiter_status_t 	status 		= eRATE_LIMITER_OK;
+	uint32_t				stride		= 0;
+	uintptr_t				addr		= 0;
+	uint16_t				k_rise		= 0;
+	uint16_t				k_fall		= 0;
+	uint32_t				ch			= 0;
+
+	#if ( 1 == RATE_LIMITER_BANK_SIMD_EN )
+		pf_rate_limiter_bank16_kernel_t pf_simd = NULL;
+	#endif
+
+	if 	(	( NULL != p_bank )
+		&&	( num_of_ch > 0U )
+		&&	( format < eRATE_LIMITER_BANK16_NUM_OF )
+		&& 	( dt > 0.0f ))
+	{
+		// Allocate space
+		*p_bank = malloc( sizeof( rate_limiter_bank16_t ));
+
+		if ( NULL != *p_bank )
+		{
+			// Round array length up to whole aligned blocks
+			stride = (( num_of_ch + RATE_LIMITER_BANK16_CH_PER_ALIGN - 1U ) / RATE_LIMITER_BANK16_CH_PER_ALIGN ) * RATE_LIMITER_BANK16_CH_PER_ALIGN;
+
+			// Allocate all arrays as single block with spare space for alignment
+			(*p_bank)->p_mem = malloc(( 4U * stride * sizeof( uint16_t )) + RATE_LIMITER_BANK_ALIGN );
+
+			if ( NULL != (*p_bank)->p_mem )
+			{
+				// Align arrays
+				addr = ((uintptr_t) (*p_bank)->p_mem + RATE_LIMITER_BANK_ALIGN - 1U ) & ~((uintptr_t) RATE_LIMITER_BANK_ALIGN - 1U );
+
+				(*p_bank)->p_x_prev = (uint16_t*) addr;
+				(*p_bank)->p_x_res 	= (int16_t*)( (*p_bank)->p_x_prev + stride );
+				(*p_bank)->p_k_rise = (*p_bank)->p_x_prev + ( 2U * stride );
+				(*p_bank)->p_k_fall = (*p_bank)->p_k_rise + stride;
+
+				// Calculate rise/fall factors
+				k_rise = rate_limiter_bank16_narrow( format, rate_limiter_calc_rate_factor( dt, rise_rate ));
+				k_fall = rate_limiter_bank16_narrow( format, rate_limiter_calc_rate_factor( dt, fall_rate ));
+
+				// Init channels
+				for ( ch = 0; ch < stride; ch++ )
+				{
+					(*p_bank)->p_x_prev[ch] = 0U;
+					(*p_bank)->p_x_res[ch] 	= 0;
+					(*p_bank)->p_k_rise[ch] = k_rise;
+					(*p_bank)->p_k_fall[ch] = k_fall;
+				}
+
+				(*p_bank)->format = format;
+				(*p_bank)->dt = dt;
+				(*p_bank)->num_of_ch = num_of_ch;
+
+				// Select update kernel
+				if ( eRATE_LIMITER_BANK16_BF16 == format )
+				{
+					(*p_bank)->pf_kernel = &rate_limiter_bank16_bf16_kernel;
+				}
+				else
+				{
+					(*p_bank)->pf_kernel = &rate_limiter_bank16_fp16_kernel;
+				}
+
+				#if ( 1 == RATE_LIMITER_BANK_SIMD_EN )
+					pf_simd = rate_limiter_simd_get_bank16_kernel( format );
+
+					if ( NULL != pf_simd )
+					{
+						(*p_bank)->pf_kernel = pf_simd;
+					}
+				#endif
+
+				// Init success
+				(*p_bank)->is_init = true;
+			}
+			else
+			{
+				free( *p_bank );
+				*p_bank = NULL;
+
+				status = eRATE_LIMITER_ERROR;
+			}
+		}
+		else
+		{
+			status = eRATE_LIMITER_ERROR;
+		}
+	}
+	else
+	{
+		status = eRATE_LIMITER_ERROR;
+	}
+
+	return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/*!
+* @brief    De-initialize 16-bit storage rate limiter bank
+*
+* @param[in,out]  	p_bank		- Pointer to 16-bit storage rate limiter bank
+* @return       	status		- Either OK or Error
+*/
+////////////////////////////////////////////////////////////////////////////////
+rate_limiter_status_t rate_limiter_bank16_deinit(p_rate_limiter_bank16_t * p_bank)
+{
+	rate_limiter_status_t status = eRATE_LIMITER_ERROR;
+
+	// Check for bank and initialization
+	if ( NULL != p_bank )
+	{
+		if ( true == rate_limiter_bank16_is_init( *p_bank ))
+		{
+			(*p_bank)->is_init = false;
+
+			free( (*p_bank)->p_mem );
+			free( *p_bank );
+
+			*p_bank = NULL;
+
+			status = eRATE_LIMITER_OK;
+		}
+	}
+
+	return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/*!
+* @brief    Update all channels of 16-bit storage rate limiter bank
+*
+* @note Input and output buffer must hold at least number of channels
+* 		samples and may point to the same location. Output is new channel
+* 		state as stored, widened to float.
+*
+* @param[in]  	bank		- Pointer to 16-bit storage rate limiter bank
+* @param[in]  	p_x			- Pointer to input signals, one per channel
+* @param[out]  	p_y			- Pointer to output (slew limited) signals, one per channel
+* @return       status		- Either OK or Error
+*/
+////////////////////////////////////////////////////////////////////////////////
+rate_limiter_status_t rate_limiter_bank16_update(p_rate_limiter_bank16_t bank, const float32_t * const p_x, float32_t * const p_y)
+{
+	rate_limiter_status_t status = eRATE_LIMITER_ERROR;
+
+	// Check for bank, initialization and buffers
+	if 	(	( NULL != bank )
+		&&	( NULL != p_x )
+		&&	( NULL != p_y ))
+	{
+		if ( true == bank->is_init )
+		{
+			bank->pf_kernel( p_x, p_y, bank->p_x_prev, bank->p_x_res, bank->p_k_rise, bank->p_k_fall, bank->num_of_ch );
+
+			status = eRATE_LIMITER_OK;
+		}
+	}
+
+	return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/*!
+* @brief    Get success initialization flag of 16-bit storage bank
+*
+* @param[in]  	bank		- Pointer to 16-bit storage rate limiter bank
+* @return       is_init		- Success initialization flag
+*/
+////////////////////////////////////////////////////////////////////////////////
+bool rate_limiter_bank16_is_init(p_rate_limiter_bank16_t bank)
+{
+	bool is_init = false;
+
+	if ( NULL != bank )
+	{
+		is_init = bank->is_init;
+	}
+
+	return is_init;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/*!
+* @brief    Change slew rate of single 16-bit storage bank channel
+*
+* @param[in]  	bank		- Pointer to 16-bit storage rate limiter bank
+* @param[in]  	ch			- Channel index
+* @param[in]  	rise_rate	- Rising slew rate
+* @param[in]  	fall_rate	- Falling slew rate
+* @return       status		- Either OK or Error
+*/
+////////////////////////////////////////////////////////////////////////////////
+rate_limiter_status_t rate_limiter_bank16_change_rate(p_rate_limiter_bank16_t bank, const uint32_t ch, const float32_t rise_rate, const float32_t fall_rate)
+{
+	rate_limiter_status_t status = eRATE_LIMITER_ERROR;
+
+	// Check for bank, initialization and channel
+	if ( NULL != bank )
+	{
+		if 	(	( true == bank->is_init )
+			&&	( ch < bank->num_of_ch ))
+		{
+			bank->p_k_rise[ch] = rate_limiter_bank16_narrow( bank->format, rate_limiter_calc_rate_factor( bank->dt, rise_rate ));
+			bank->p_k_fall[ch] = rate_limiter_bank16_narrow( bank->format, rate_limiter_calc_rate_factor( bank->dt, fall_rate ));
+
+			status = eRATE_LIMITER_OK;
+		}
+	}
+
+	return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+* @} <!-- END GROUP -->
+*/
+////////////////////////////////////////////////////////////////////////////////
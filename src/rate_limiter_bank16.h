@@ -0,0 +1,64 @@
+// Copyright (c) 2021 Ziga Miklosic
+// All Rights Reserved
+// This software is under MIT licence (https://opensource.org/licenses/MIT)
+////////////////////////////////////////////////////////////////////////////////
+/**
+*@file      rate_limiter_bank16.h
+*@brief     Multi-channel rate limiter bank with 16-bit storage
+*@author    Ziga Miklosic
+*@date      19.02.2021
+*@version   V1.1.0
+*/
+////////////////////////////////////////////////////////////////////////////////
+/**
+*@addtogroup RATE_LIMITER_BANK16_API
+* @{ <!-- BEGIN GROUP -->
+*
+*/
+////////////////////////////////////////////////////////////////////////////////
+
+#ifndef __RATE_LIMITER_BANK16_H
+#define __RATE_LIMITER_BANK16_H
+
+////////////////////////////////////////////////////////////////////////////////
+// Includes
+////////////////////////////////////////////////////////////////////////////////
+#include "rate_limiter.h"
+#include "rate_limiter_bank.h"
+
+////////////////////////////////////////////////////////////////////////////////
+// Definitions
+////////////////////////////////////////////////////////////////////////////////
+
+/**
+ * 	Storage format of channel state
+ */
+typedef enum
+{
+	eRATE_LIMITER_BANK16_FP16 = 0,	/**<IEEE half precision */
+	eRATE_LIMITER_BANK16_BF16,		/**<Brain floating point (bfloat16) */
+
+	eRATE_LIMITER_BANK16_NUM_OF,
+} rate_limiter_bank16_format_t;
+
+/**
+ * 	Pointer to 16-bit storage rate limiter bank
+ */
+typedef struct rate_limiter_bank16_s * p_rate_limiter_bank16_t;
+
+////////////////////////////////////////////////////////////////////////////////
+// Functions
+////////////////////////////////////////////////////////////////////////////////
+rate_limiter_status_t	rate_limiter_bank16_init		(p_rate_limiter_bank16_t * p_bank, const uint32_t num_of_ch, const rate_limiter_bank16_format_t format, const float32_t rise_rate, const float32_t fall_rate, const float32_t dt);
+rate_limiter_status_t	rate_limiter_bank16_deinit		(p_rate_limiter_bank16_t * p_bank);
+rate_limiter_status_t	rate_limiter_bank16_update		(p_rate_limiter_bank16_t bank, const float32_t * const p_x, float32_t * const p_y);
+bool					rate_limiter_bank16_is_init		(p_rate_limiter_bank16_t bank);
+rate_limiter_status_t	rate_limiter_bank16_change_rate	(p_rate_limiter_bank16_t bank, const uint32_t ch, const float32_t rise_rate, const float32_t fall_rate);
+
+#endif // __RATE_LIMITER_BANK16_H
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+* @} <!-- END GROUP -->
+*/
+////////////////////////////////////////////////////////////////////////////////
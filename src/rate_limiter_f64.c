@@ -0,0 +1,569 @@
+// Copyright (c) 2021 Ziga Miklosic
+// All Rights Reserved
+// This software is under MIT licence (https://opensource.org/licenses/MIT)
+////////////////////////////////////////////////////////////////////////////////
+/**
+*@file      rate_limiter_f64.c
+*@brief     Double precision rate limiter
+*@author    Ziga Miklosic
+*@date      19.02.2021
+*@version   V1.1.0
+*
+*@section Description
+*
+*	Double precision variant of rate limiter for long running signals
+*	where float32_t previous value accumulates rounding error after
+*	millions of updates. Behaviour is the same as with single precision
+*	rate limiter, only computed in float64_t.
+*
+*	Definition of float64_t must be provided by user in
+*	"project_config.h", same as float32_t.
+*
+*	Double precision bank holds many channels in aligned parallel arrays
+*	and updates them with branchless, vectorizable kernel.
+*
+*/
+////////////////////////////////////////////////////////////////////////////////
+/*!
+* @addtogroup RATE_LIMITER_F64
+* @{ <!-- BEGIN GROUP -->
+*/
+////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////
+// Includes
+////////////////////////////////////////////////////////////////////////////////
+#include "rate_limiter_f64.h"
+#include "rate_limiter_bank.h"
+
+
+////////////////////////////////////////////////////////////////////////////////
+// Definitions
+////////////////////////////////////////////////////////////////////////////////
+
+/**
+ * 	Initialization sentinel
+ */
+#define RATE_LIMITER_F64_INIT_MAGIC			( 0x52463634UL )
+
+/**
+ * 	Number of channels per aligned array block
+ */
+#define RATE_LIMITER_F64_CH_PER_ALIGN		( RATE_LIMITER_BANK_ALIGN / sizeof( float64_t ))
+
+/**
+ * 	Raw bit access to double value
+ */
+typedef union
+{
+	float64_t	f;	/**<Double value */
+	uint64_t	u;	/**<Raw bits */
+} rate_limiter_f64_bits_t;
+
+/**
+ * 	Double precision slew rate limiter bank
+ */
+typedef struct rate_limiter_f64_bank_s
+{
+	float64_t *	p_x_prev;	/**<Previous values of channels */
+	float64_t *	p_k_rise;	/**<Rising slew rate factors of channels */
+	float64_t * p_k_fall;	/**<Falling slew rate factors of channels */
+	void *		p_mem;		/**<Allocated memory space of channel arrays */
+	float64_t 	dt;			/**<Period of update */
+	uint32_t	num_of_ch;	/**<Number of channels */
+	bool		is_init;	/**<Rate limiter bank initialization success flag */
+} rate_limiter_f64_bank_t;
+
+////////////////////////////////////////////////////////////////////////////////
+// Variables
+////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////
+// Function prototypes
+////////////////////////////////////////////////////////////////////////////////
+static inline float64_t	rate_limiter_f64_select		(const bool cond, const float64_t a, const float64_t b);
+static inline float64_t	rate_limiter_f64_limit_sel	(const float64_t x, const float64_t x_prev, const float64_t k_rise, const float64_t k_fall);
+static inline float64_t	rate_limiter_f64_limit		(const float64_t x, const float64_t x_prev, const float64_t k_rise, const float64_t k_fall);
+
+////////////////////////////////////////////////////////////////////////////////
+// Functions
+////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////
+/*!
+* @brief    Branchless select between two double values
+*
+* @param[in]  	cond		- Selection condition
+* @param[in]  	a			- Value selected when condition is true
+* @param[in]  	b			- Value selected when condition is false
+* @return       y			- Selected value
+*/
+////////////////////////////////////////////////////////////////////////////////
+static inline float64_t rate_limiter_f64_select(const bool cond, const float64_t a, const float64_t b)
+{
+	const uint64_t mask = ( 0U - (uint64_t) cond );
+	rate_limiter_f64_bits_t a_bits;
+	rate_limiter_f64_bits_t b_bits;
+	rate_limiter_f64_bits_t y_bits;
+
+	a_bits.f = a;
+	b_bits.f = b;
+
+	y_bits.u = (( a_bits.u & mask ) | ( b_bits.u & ~mask ));
+
+	return y_bits.f;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/*!
+* @brief    Slew limit double input signal, select form
+*
+* @note Bit exact to "rate_limiter_f64_limit()" but without control flow.
+*
+* @param[in]  	x			- Input signal
+* @param[in]  	x_prev		- Previous output signal
+* @param[in]  	k_rise		- Rising slew rate factor
+* @param[in]  	k_fall		- Falling slew rate factor
+* @return       y			- Output (slew limited) signal
+*/
+////////////////////////////////////////////////////////////////////////////////
+static inline float64_t rate_limiter_f64_limit_sel(const float64_t x, const float64_t x_prev, const float64_t k_rise, const float64_t k_fall)
+{
+	const float64_t dx 		= x - x_prev;
+	const float64_t y_rise 	= x_prev + k_rise;
+	const float64_t y_fall 	= x_prev - k_fall;
+	float64_t		y		= 0.0;
+
+	y = rate_limiter_f64_select(( dx <= -( k_fall )), y_fall, x );
+	y = rate_limiter_f64_select(( dx >= k_rise ), y_rise, y );
+
+	return y;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/*!
+* @brief    Slew limit double input signal against previous output
+*
+* @note With RATE_LIMITER_BRANCHLESS_EN enabled select form is used.
+*
+* @param[in]  	x			- Input signal
+* @param[in]  	x_prev		- Previous output signal
+* @param[in]  	k_rise		- Rising slew rate factor
+* @param[in]  	k_fall		- Falling slew rate factor
+* @return       y			- Output (slew limited) signal
+*/
+////////////////////////////////////////////////////////////////////////////////
+static inline float64_t rate_limiter_f64_limit(const float64_t x, const float64_t x_prev, const float64_t k_rise, const float64_t k_fall)
+{
+	float64_t y = 0.0;
+
+#if ( 1 == RATE_LIMITER_BRANCHLESS_EN )
+
+	y = rate_limiter_f64_limit_sel( x, x_prev, k_rise, k_fall );
+
+#else
+
+	const float64_t dx = x - x_prev;
+
+	// Rising limit
+	if ( dx >= k_rise )
+	{
+		y = x_prev + k_rise;
+	}
+
+	// Falling limit
+	else if ( dx <= -( k_fall ))
+	{
+		y = x_prev - k_fall;
+	}
+
+	// No limitations...
+	else
+	{
+		y = x;
+	}
+
+#endif
+
+	return y;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+* @} <!-- END GROUP -->
+*/
+////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*@addtogroup RATE_LIMITER_F64_API
+* @{ <!-- BEGIN GROUP -->
+*
+* 	Following function are part or double precision rate limiter API.
+*/
+////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////
+/*!
+* @brief    Initialize double precision rate limiter
+*
+* @note Instance memory is provided by user. Slew rate units are the same
+* 		as with "rate_limiter_init()".
+*
+* @param[out]  	p_inst		- Pointer to double precision rate limiter instance
+* @param[in]  	rise_rate	- Rising slew rate
+* @param[in]  	fall_rate	- Falling slew rate
+* @param[in]  	dt			- Update (period) time
+* @return       status		- Either OK or Error
+*/
+////////////////////////////////////////////////////////////////////////////////
+rate_limiter_status_t rate_limiter_f64_init(rate_limiter_f64_t * const p_inst, const float64_t rise_rate, const float64_t fall_rate, const float64_t dt)
+{
+	rate_limiter_status_t status = eRATE_LIMITER_OK;
+
+	if 	(	( NULL != p_inst )
+		&& 	( dt > 0.0 ))
+	{
+		p_inst->x_prev = 0.0;
+		p_inst->dt = dt;
+		p_inst->k_rise = ( rise_rate * dt );
+		p_inst->k_fall = ( fall_rate * dt );
+
+		// Init success
+		p_inst->init = RATE_LIMITER_F64_INIT_MAGIC;
+	}
+	else
+	{
+		status = eRATE_LIMITER_ERROR;
+	}
+
+	return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/*!
+* @brief    Update double precision rate limiter
+*
+* @param[in]  	p_inst		- Pointer to double precision rate limiter instance
+* @param[in]  	x			- Input signal
+* @return       y			- Output (slew limited) signal
+*/
+////////////////////////////////////////////////////////////////////////////////
+float64_t rate_limiter_f64_update(rate_limiter_f64_t * const p_inst, const float64_t x)
+{
+	float64_t y = 0.0;
+
+	// Check for instance and initialization
+	if ( NULL != p_inst )
+	{
+		if ( RATE_LIMITER_F64_INIT_MAGIC == p_inst->init )
+		{
+			y = rate_limiter_f64_limit( x, p_inst->x_prev, p_inst->k_rise, p_inst->k_fall );
+
+			// Store current value
+			p_inst->x_prev = y;
+		}
+	}
+
+	return y;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/*!
+* @brief    Update double precision rate limiter over block of samples
+*
+* @note Input and output buffer may point to the same location.
+*
+* @param[in]  	p_inst		- Pointer to double precision rate limiter instance
+* @param[in]  	p_x			- Pointer to input signal samples
+* @param[out]  	p_y			- Pointer to output (slew limited) signal samples
+* @param[in]  	size		- Number of samples in block
+* @return       status		- Either OK or Error
+*/
+////////////////////////////////////////////////////////////////////////////////
+rate_limiter_status_t rate_limiter_f64_update_block(rate_limiter_f64_t * const p_inst, const float64_t * const p_x, float64_t * const p_y, const size_t size)
+{
+	rate_limiter_status_t 	status 	= eRATE_LIMITER_ERROR;
+	float64_t				x_prev	= 0.0;
+	size_t					i		= 0;
+
+	// Check for instance, initialization and buffers
+	if 	(	( NULL != p_inst )
+		&&	( NULL != p_x )
+		&&	( NULL != p_y ))
+	{
+		if ( RATE_LIMITER_F64_INIT_MAGIC == p_inst->init )
+		{
+			x_prev = p_inst->x_prev;
+
+			for ( i = 0; i < size; i++ )
+			{
+				x_prev = rate_limiter_f64_limit( p_x[i], x_prev, p_inst->k_rise, p_inst->k_fall );
+				p_y[i] = x_prev;
+			}
+
+			p_inst->x_prev = x_prev;
+
+			status = eRATE_LIMITER_OK;
+		}
+	}
+
+	return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/*!
+* @brief    Get success initialization flag of double precision rate limiter
+*
+* @param[in]  	p_inst		- Pointer to double precision rate limiter instance
+* @return       is_init		- Success initialization flag
+*/
+////////////////////////////////////////////////////////////////////////////////
+bool rate_limiter_f64_is_init(const rate_limiter_f64_t * const p_inst)
+{
+	bool is_init = false;
+
+	if ( NULL != p_inst )
+	{
+		is_init = ( RATE_LIMITER_F64_INIT_MAGIC == p_inst->init );
+	}
+
+	return is_init;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/*!
+* @brief    Change slew rate of double precision rate limiter
+*
+* @param[in]  	p_inst		- Pointer to double precision rate limiter instance
+* @param[in]  	rise_rate	- Rising slew rate
+* @param[in]  	fall_rate	- Falling slew rate
+* @return       status		- Either OK or Error
+*/
+////////////////////////////////////////////////////////////////////////////////
+rate_limiter_status_t rate_limiter_f64_change_rate(rate_limiter_f64_t * const p_inst, const float64_t rise_rate, const float64_t fall_rate)
+{
+	rate_limiter_status_t status = eRATE_LIMITER_ERROR;
+
+	// Check for instance and initialization
+	if ( true == rate_limiter_f64_is_init( p_inst ))
+	{
+		p_inst->k_rise = ( rise_rate * p_inst->dt );
+		p_inst->k_fall = ( fall_rate * p_inst->dt );
+
+		status = eRATE_LIMITER_OK;
+	}
+
+	return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/*!
+* @brief    Initialize double precision rate limiter bank
+*
+* @param[out]  	p_bank		- Pointer to double precision rate limiter bank
+* @param[in]  	num_of_ch	- Number of channels
+* @param[in]  	rise_rate	- Rising slew rate
+* @param[in]  	fall_rate	- Falling slew rate
+* @param[in]  	dt			- Update (period) time
+* @return       status		- Either OK or Error
+*/
+////////////////////////////////////////////////////////////////////////////////
+rate_limiter_status_t rate_limiter_f64_bank_init(p_rate_limiter_f64_bank_t * p_bank, const uint32_t num_of_ch, const float64_t rise_rate, const float64_t fall_rate, const float64_t dt)
+{
+	rate_limiter_status_t 	status 		= eRATE_LIMITER_OK;
+	uint32_t				stride		= 0;
+	uintptr_t				addr		= 0;
+	uint32_t				ch			= 0;
+
+	if 	(	( NULL != p_bank )
+		&&	( num_of_ch > 0U )
+		&& 	( dt > 0.0 ))
+	{
+		// Allocate space
+		*p_bank = malloc( sizeof( rate_limiter_f64_bank_t ));
+
+		if ( NULL != *p_bank )
+		{
+			// Round array length up to whole aligned blocks
+			stride = (( num_of_ch + RATE_LIMITER_F64_CH_PER_ALIGN - 1U ) / RATE_LIMITER_F64_CH_PER_ALIGN ) * RATE_LIMITER_F64_CH_PER_ALIGN;
+
+			// Allocate all arrays as single block with spare space for alignment
+			(*p_bank)->p_mem = malloc(( 3U * stride * sizeof( float64_t )) + RATE_LIMITER_BANK_ALIGN );
+
+			if ( NULL != (*p_bank)->p_mem )
+			{
+				// Align arrays
+				addr = ((uintptr_t) (*p_bank)->p_mem + RATE_LIMITER_BANK_ALIGN - 1U ) & ~((uintptr_t) RATE_LIMITER_BANK_ALIGN - 1U );
+
+				(*p_bank)->p_x_prev = (float64_t*) addr;
+				(*p_bank)->p_k_rise = (*p_bank)->p_x_prev + stride;
+				(*p_bank)->p_k_fall = (*p_bank)->p_k_rise + stride;
+
+				// Init channels
+				for ( ch = 0; ch < stride; ch++ )
+				{
+					(*p_bank)->p_x_prev[ch] = 0.0;
+					(*p_bank)->p_k_rise[ch] = ( rise_rate * dt );
+					(*p_bank)->p_k_fall[ch] = ( fall_rate * dt );
+				}
+
+				(*p_bank)->dt = dt;
+				(*p_bank)->num_of_ch = num_of_ch;
+
+				// Init success
+				(*p_bank)->is_init = true;
+			}
+			else
+			{
+				free( *p_bank );
+				*p_bank = NULL;
+
+				status = eRATE_LIMITER_ERROR;
+			}
+		}
+		else
+		{
+			status = eRATE_LIMITER_ERROR;
+		}
+	}
+	else
+	{
+		status = eRATE_LIMITER_ERROR;
+	}
+
+	return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/*!
+* @brief    De-initialize double precision rate limiter bank
+*
+* @param[in,out]  	p_bank		- Pointer to double precision rate limiter bank
+* @return       	status		- Either OK or Error
+*/
+////////////////////////////////////////////////////////////////////////////////
+rate_limiter_status_t rate_limiter_f64_bank_deinit(p_rate_limiter_f64_bank_t * p_bank)
+{
+	rate_limiter_status_t status = eRATE_LIMITER_ERROR;
+
+	// Check for bank and initialization
+	if ( NULL != p_bank )
+	{
+		if ( true == rate_limiter_f64_bank_is_init( *p_bank ))
+		{
+			(*p_bank)->is_init = false;
+
+			free( (*p_bank)->p_mem );
+			free( *p_bank );
+
+			*p_bank = NULL;
+
+			status = eRATE_LIMITER_OK;
+		}
+	}
+
+	return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/*!
+* @brief    Update all channels of double precision rate limiter bank
+*
+* @note Input and output buffer must hold at least number of channels
+* 		samples and may point to the same location.
+*
+* @param[in]  	bank		- Pointer to double precision rate limiter bank
+* @param[in]  	p_x			- Pointer to input signals, one per channel
+* @param[out]  	p_y			- Pointer to output (slew limited) signals, one per channel
+* @return       status		- Either OK or Error
+*/
+////////////////////////////////////////////////////////////////////////////////
+rate_limiter_status_t rate_limiter_f64_bank_update(p_rate_limiter_f64_bank_t bank, const float64_t * const p_x, float64_t * const p_y)
+{
+	rate_limiter_status_t 		status 	= eRATE_LIMITER_ERROR;
+	float64_t * restrict 		x_prev 	= NULL;
+	const float64_t * restrict 	k_rise 	= NULL;
+	const float64_t * restrict 	k_fall 	= NULL;
+	uint32_t					ch		= 0;
+
+	// Check for bank, initialization and buffers
+	if 	(	( NULL != bank )
+		&&	( NULL != p_x )
+		&&	( NULL != p_y ))
+	{
+		if ( true == bank->is_init )
+		{
+			x_prev = bank->p_x_prev;
+			k_rise = bank->p_k_rise;
+			k_fall = bank->p_k_fall;
+
+			for ( ch = 0; ch < bank->num_of_ch; ch++ )
+			{
+				x_prev[ch] 	= rate_limiter_f64_limit_sel( p_x[ch], x_prev[ch], k_rise[ch], k_fall[ch] );
+				p_y[ch]		= x_prev[ch];
+			}
+
+			status = eRATE_LIMITER_OK;
+		}
+	}
+
+	return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/*!
+* @brief    Get success initialization flag of double precision bank
+*
+* @param[in]  	bank		- Pointer to double precision rate limiter bank
+* @return       is_init		- Success initialization flag
+*/
+////////////////////////////////////////////////////////////////////////////////
+bool rate_limiter_f64_bank_is_init(p_rate_limiter_f64_bank_t bank)
+{
+	bool is_init = false;
+
+	if ( NULL != bank )
+	{
+		is_init = bank->is_init;
+	}
+
+	return is_init;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/*!
+* @brief    Change slew rate of single double precision bank channel
+*
+* @param[in]  	bank		- Pointer to double precision rate limiter bank
+* @param[in]  	ch			- Channel index
+* @param[in]  	rise_rate	- Rising slew rate
+* @param[in]  	fall_rate	- Falling slew rate
+* @return       status		- Either OK or Error
+*/
+////////////////////////////////////////////////////////////////////////////////
+rate_limiter_status_t rate_limiter_f64_bank_change_rate(p_rate_limiter_f64_bank_t bank, const uint32_t ch, const float64_t rise_rate, const float64_t fall_rate)
+{
+	rate_limiter_status_t status = eRATE_LIMITER_ERROR;
+
+	// Check for bank, initialization and channel
+	if ( NULL != bank )
+	{
+		if 	(	( true == bank->is_init )
+			&&	( ch < bank->num_of_ch ))
+		{
+			bank->p_k_rise[ch] = ( rise_rate * bank->dt );
+			bank->p_k_fall[ch] = ( fall_rate * bank->dt );
+
+			status = eRATE_LIMITER_OK;
+		}
+	}
+
+	return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+* @} <!-- END GROUP -->
+*/
+////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,73 @@
+// Copyright (c) 2021 Ziga Miklosic
+// All Rights Reserved
+// This software is under MIT licence (https://opensource.org/licenses/MIT)
+////////////////////////////////////////////////////////////////////////////////
+/**
+*@file      rate_limiter_f64.h
+*@brief     Double precision rate limiter
+*@author    Ziga Miklosic
+*@date      19.02.2021
+*@version   V1.1.0
+*/
+////////////////////////////////////////////////////////////////////////////////
+/**
+*@addtogroup RATE_LIMITER_F64_API
+* @{ <!-- BEGIN GROUP -->
+*
+*/
+////////////////////////////////////////////////////////////////////////////////
+
+#ifndef __RATE_LIMITER_F64_H
+#define __RATE_LIMITER_F64_H
+
+////////////////////////////////////////////////////////////////////////////////
+// Includes
+////////////////////////////////////////////////////////////////////////////////
+#include "rate_limiter.h"
+
+////////////////////////////////////////////////////////////////////////////////
+// Definitions
+////////////////////////////////////////////////////////////////////////////////
+
+/**
+ * 	Double precision slew rate limiter
+ *
+ * @note Instance is owned by user and fields shall only be accessed by
+ * 		"rate_limiter_f64_" functions.
+ */
+typedef struct
+{
+	float64_t	x_prev;		/**<Previous value of input */
+	float64_t	k_rise;		/**<Rising slew rate factor */
+	float64_t	k_fall;		/**<Falling slew rate factor */
+	float64_t	dt;			/**<Period of update */
+	uint32_t	init;		/**<Initialization sentinel */
+} rate_limiter_f64_t;
+
+/**
+ * 	Pointer to double precision rate limiter bank
+ */
+typedef struct rate_limiter_f64_bank_s * p_rate_limiter_f64_bank_t;
+
+////////////////////////////////////////////////////////////////////////////////
+// Functions
+////////////////////////////////////////////////////////////////////////////////
+rate_limiter_status_t	rate_limiter_f64_init			(rate_limiter_f64_t * const p_inst, const float64_t rise_rate, const float64_t fall_rate, const float64_t dt);
+float64_t				rate_limiter_f64_update			(rate_limiter_f64_t * const p_inst, const float64_t x);
+rate_limiter_status_t	rate_limiter_f64_update_block	(rate_limiter_f64_t * const p_inst, const float64_t * const p_x, float64_t * const p_y, const size_t size);
+bool					rate_limiter_f64_is_init		(const rate_limiter_f64_t * const p_inst);
+rate_limiter_status_t	rate_limiter_f64_change_rate	(rate_limiter_f64_t * const p_inst, const float64_t rise_rate, const float64_t fall_rate);
+
+rate_limiter_status_t	rate_limiter_f64_bank_init			(p_rate_limiter_f64_bank_t * p_bank, const uint32_t num_of_ch, const float64_t rise_rate, const float64_t fall_rate, const float64_t dt);
+rate_limiter_status_t	rate_limiter_f64_bank_deinit		(p_rate_limiter_f64_bank_t * p_bank);
+rate_limiter_status_t	rate_limiter_f64_bank_update		(p_rate_limiter_f64_bank_t bank, const float64_t * const p_x, float64_t * const p_y);
+bool					rate_limiter_f64_bank_is_init		(p_rate_limiter_f64_bank_t bank);
+rate_limiter_status_t	rate_limiter_f64_bank_change_rate	(p_rate_limiter_f64_bank_t bank, const uint32_t ch, const float64_t rise_rate, const float64_t fall_rate);
+
+#endif // __RATE_LIMITER_F64_H
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+* @} <!-- END GROUP -->
+*/
+////////////////////////////////////////////////////////////////////////////////
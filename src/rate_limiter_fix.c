@@ -0,0 +1,1090 @@
+// Copyright (c) 2021 Ziga Miklosic
+// All Rights Reserved
+// This software is under MIT licence (https://opensource.org/licenses/MIT)
+////////////////////////////////////////////////////////////////////////////////
+/**
+*@file      rate_limiter_fix.c
+*@brief     Fixed point (Q15/Q31) rate limiter
+*@author    Ziga Miklosic
+*@date      19.02.2021
+*@version   V1.1.0
+*
+*@section Description
+*
+*	Fixed point variant of rate limiter for integer signal paths (e.g.
+*	ADC & DAC samples), so no conversion to and from float is needed.
+*	Update is done purely in integer arithmetic, thus it is exact and
+*	deterministic. Output never leaves range of the type, as limited
+*	output always lies between previous output and input.
+*
+*	Slew rates are given in full scale units per second, where full
+*	scale of 1.0 equals 2^15 for Q15 and 2^31 for Q31. Slew rate factors
+*	are computed once at initialization and rounded to nearest integer.
+*
+*	Q15 bank holds many int16_t channels in aligned parallel arrays and
+*	updates them in clamp form (saturating add/sub & min/max). With
+*	RATE_LIMITER_BANK_SIMD_EN enabled, AVX2 or AVX-512BW kernel is used,
+*	processing 16 or 32 channels per instruction.
+*
+*	Q31 bank holds many int32_t channels in the same aligned parallel
+*	array layout. It is updated by portable clamp form kernel with
+*	difference computed in 64-bit, which compiler may vectorize.
+*
+*@section Code_example
+*@code
+*
+*	// Declare Q15 rate limiter instance
+*	static rate_limiter_q15_t my_rate_limiter;
+*
+*	// Initialize: rise 0.5 FS/s, fall 1.0 FS/s
+*	if ( eRATE_LIMITER_OK != rate_limiter_q15_init( &my_rate_limiter, 0.5f, 1.0f, period_time ))
+*	{
+*		// Init failed...
+*		// Furhter actions here...
+*	}
+*
+*	// Update (slew limit wanted signal)
+*	@period_time
+*	{
+*		dac_sample = rate_limiter_q15_update( &my_rate_limiter, adc_sample );
+*	}
+*
+*@endcode
+*
+*/
+////////////////////////////////////////////////////////////////////////////////
+/*!
+* @addtogroup RATE_LIMITER_FIX
+* @{ <!-- BEGIN GROUP -->
+*/
+////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////
+// Includes
+////////////////////////////////////////////////////////////////////////////////
+#include "rate_limiter_fix.h"
+#include "rate_limiter_bank.h"
+#include "rate_limiter_kernel.h"
+#include "rate_limiter_simd.h"
+
+
+////////////////////////////////////////////////////////////////////////////////
+// Definitions
+////////////////////////////////////////////////////////////////////////////////
+
+/**
+ * 	Full scale of fixed point formats
+ */
+#define RATE_LIMITER_Q15_FULL_SCALE			( 32768.0f )
+#define RATE_LIMITER_Q31_FULL_SCALE			( 2147483648.0f )
+
+/**
+ * 	Initialization sentinels
+ */
+#define RATE_LIMITER_Q15_INIT_MAGIC			( 0x5135U )
+#define RATE_LIMITER_Q31_INIT_MAGIC			( 0x51333149UL )
+
+/**
+ * 	Number of Q15 channels per aligned array block
+ */
+#define RATE_LIMITER_Q15_CH_PER_ALIGN		( RATE_LIMITER_BANK_ALIGN / sizeof( int16_t ))
+
+/**
+ * 	Number of Q31 channels per aligned array block
+ */
+#define RATE_LIMITER_Q31_CH_PER_ALIGN		( RATE_LIMITER_BANK_ALIGN / sizeof( int32_t ))
+
+/**
+ * 	Q15 slew rate limiter bank
+ */
+typedef struct rate_limiter_q15_bank_s
+{
+	int16_t *							p_x_prev;	/**<Previous values of channels */
+	int16_t *							p_k_rise;	/**<Rising slew rate factors of channels */
+	int16_t * 							p_k_fall;	/**<Falling slew rate factors of channels */
+	void *								p_mem;		/**<Allocated memory space of channel arrays */
+	pf_rate_limiter_q15_bank_kernel_t	pf_kernel;	/**<Update kernel */
+	float32_t 							dt;			/**<Period of update */
+	uint32_t							num_of_ch;	/**<Number of channels */
+	bool								is_init;	/**<Rate limiter bank initialization success flag */
+} rate_limiter_q15_bank_t;
+
+/**
+ * 	Q31 slew rate limiter bank
+ */
+typedef struct rate_limiter_q31_bank_s
+{
+	int32_t *	p_x_prev;	/**<Previous values of channels */
+	int32_t *	p_k_rise;	/**<Rising slew rate factors of channels */
+	int32_t * 	p_k_fall;	/**<Falling slew rate factors of channels */
+	void *		p_mem;		/**<Allocated memory space of channel arrays */
+	float32_t 	dt;			/**<Period of update */
+	uint32_t	num_of_ch;	/**<Number of channels */
+	bool		is_init;	/**<Rate limiter bank initialization success flag */
+} rate_limiter_q31_bank_t;
+
+////////////////////////////////////////////////////////////////////////////////
+// Variables
+////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////
+// Function prototypes
+////////////////////////////////////////////////////////////////////////////////
+static int32_t			rate_limiter_fix_calc_rate_factor	(const float32_t dt, const float32_t slew_rate, const float32_t full_scale, const int32_t k_max);
+static inline int16_t	rate_limiter_q15_limit				(const int16_t x, const int16_t x_prev, const int16_t k_rise, const int16_t k_fall);
+static inline int32_t	rate_limiter_q31_limit				(const int32_t x, const int32_t x_prev, const int32_t k_rise, const int32_t k_fall);
+static void				rate_limiter_q15_bank_update_kernel	(const int16_t * const p_x, int16_t * const p_y, int16_t * const p_x_prev, const int16_t * const p_k_rise, const int16_t * const p_k_fall, const uint32_t num_of_ch);
+static void				rate_limiter_q31_bank_update_kernel	(const int32_t * const p_x, int32_t * const p_y, int32_t * const p_x_prev, const int32_t * const p_k_rise, const int32_t * const p_k_fall, const uint32_t num_of_ch);
+
+////////////////////////////////////////////////////////////////////////////////
+// Functions
+////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////
+/*!
+* @brief    Calculate fixed point slew rate factor base on update time.
+*
+* @note Factor is rounded to nearest and saturated to [0, k_max].
+*
+* @param[in]  	dt			- Update (period) time
+* @param[in]	slew_rate	- Wanted slew rate in full scale per second
+* @param[in]	full_scale	- Full scale of fixed point format
+* @param[in]	k_max		- Maximum factor
+* @return       k_rate		- Slew rate factor
+*/
+////////////////////////////////////////////////////////////////////////////////
+static int32_t rate_limiter_fix_calc_rate_factor(const float32_t dt, const float32_t slew_rate, const float32_t full_scale, const int32_t k_max)
+{
+	int32_t 	k_rate 	= 0;
+	float32_t	k_float	= 0.0f;
+
+	k_float = ( slew_rate * dt * full_scale );
+
+	if ( k_float >= (float32_t) k_max )
+	{
+		k_rate = k_max;
+	}
+	else if ( k_float > 0.0f )
+	{
+		k_rate = (int32_t)( k_float + 0.5f );
+	}
+	else
+	{
+		k_rate = 0;
+	}
+
+	return k_rate;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/*!
+* @brief    Slew limit Q15 input signal against previous output
+*
+* @note Difference is computed in 32-bit, so it never overflows. Limited
+* 		output lies between previous output and input, thus it always
+* 		fits into Q15.
+*
+* @param[in]  	x			- Input signal
+* @param[in]  	x_prev		- Previous output signal
+* @param[in]  	k_rise		- Rising slew rate factor
+* @param[in]  	k_fall		- Falling slew rate factor
+* @return       y			- Output (slew limited) signal
+*/
+////////////////////////////////////////////////////////////////////////////////
+static inline int16_t rate_limiter_q15_limit(const int16_t x, const int16_t x_prev, const int16_t k_rise, const int16_t k_fall)
+{
+	int16_t y 	= 0;
+	int32_t dx 	= 0;
+
+	// Calculate change
+	dx = (int32_t) x - (int32_t) x_prev;
+
+	// Rising limit
+	if ( dx >= (int32_t) k_rise )
+	{
+		y = (int16_t)( x_prev + k_rise );
+	}
+
+	// Falling limit
+	else if ( dx <= -( (int32_t) k_fall ))
+	{
+		y = (int16_t)( x_prev - k_fall );
+	}
+
+	// No limitations...
+	else
+	{
+		y = x;
+	}
+
+	return y;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/*!
+* @brief    Slew limit Q31 input signal against previous output
+*
+* @note Difference is computed in 64-bit, so it never overflows. Limited
+* 		output lies between previous output and input, thus it always
+* 		fits into Q31.
+*
+* @param[in]  	x			- Input signal
+* @param[in]  	x_prev		- Previous output signal
+* @param[in]  	k_rise		- Rising slew rate factor
+* @param[in]  	k_fall		- Falling slew rate factor
+* @return       y			- Output (slew limited) signal
+*/
+////////////////////////////////////////////////////////////////////////////////
+static inline int32_t rate_limiter_q31_limit(const int32_t x, const int32_t x_prev, const int32_t k_rise, const int32_t k_fall)
+{
+	int32_t y 	= 0;
+	int64_t dx 	= 0;
+
+	// Calculate change
+	dx = (int64_t) x - (int64_t) x_prev;
+
+	// Rising limit
+	if ( dx >= (int64_t) k_rise )
+	{
+		y = (int32_t)( (int64_t) x_prev + k_rise );
+	}
+
+	// Falling limit
+	else if ( dx <= -( (int64_t) k_fall ))
+	{
+		y = (int32_t)( (int64_t) x_prev - k_fall );
+	}
+
+	// No limitations...
+	else
+	{
+		y = x;
+	}
+
+	return y;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/*!
+* @brief    Update all channels of Q15 bank
+*
+* @note Clamp form has no control flow, thus compiler is free to
+* 		vectorize it with packed saturating instructions.
+*
+* @param[in]  	p_x			- Pointer to input signals
+* @param[out]  	p_y			- Pointer to output (slew limited) signals
+* @param[in]  	p_x_prev	- Pointer to previous values
+* @param[in]  	p_k_rise	- Pointer to rising slew rate factors
+* @param[in]  	p_k_fall	- Pointer to falling slew rate factors
+* @param[in]  	num_of_ch	- Number of channels
+* @return       void
+*/
+////////////////////////////////////////////////////////////////////////////////
+static void rate_limiter_q15_bank_update_kernel(const int16_t * const p_x, int16_t * const p_y, int16_t * const p_x_prev, const int16_t * const p_k_rise, const int16_t * const p_k_fall, const uint32_t num_of_ch)
+{
+	int16_t * restrict 			x_prev 	= p_x_prev;
+	const int16_t * restrict 	k_rise 	= p_k_rise;
+	const int16_t * restrict 	k_fall 	= p_k_fall;
+	uint32_t					ch		= 0;
+
+	for ( ch = 0; ch < num_of_ch; ch++ )
+	{
+		x_prev[ch] 	= rate_limiter_q15_limit_sat( p_x[ch], x_prev[ch], k_rise[ch], k_fall[ch] );
+		p_y[ch]		= x_prev[ch];
+	}
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/*!
+* @brief    Update all channels of Q31 bank
+*
+* @note Difference is computed and clamped in 64-bit, so it never
+* 		overflows. Limited output lies between previous output and
+* 		input, thus it always fits into Q31. Clamp form has no control
+* 		flow, thus compiler is free to vectorize it.
+*
+* @param[in]  	p_x			- Pointer to input signals
+* @param[out]  	p_y			- Pointer to output (slew limited) signals
+* @param[in]  	p_x_prev	- Pointer to previous values
+* @param[in]  	p_k_rise	- Pointer to rising slew rate factors
+* @param[in]  	p_k_fall	- Pointer to falling slew rate factors
+* @param[in]  	num_of_ch	- Number of channels
+* @return       void
+*/
+////////////////////////////////////////////////////////////////////////////////
+static void rate_limiter_q31_bank_update_kernel(const int32_t * const p_x, int32_t * const p_y, int32_t * const p_x_prev, const int32_t * const p_k_rise, const int32_t * const p_k_fall, const uint32_t num_of_ch)
+{
+	int32_t * restrict 			x_prev 	= p_x_prev;
+	const int32_t * restrict 	k_rise 	= p_k_rise;
+	const int32_t * restrict 	k_fall 	= p_k_fall;
+	int64_t						dx		= 0;
+	uint32_t					ch		= 0;
+
+	for ( ch = 0; ch < num_of_ch; ch++ )
+	{
+		// Clamp change to [-k_fall, k_rise]
+		dx = (int64_t) p_x[ch] - (int64_t) x_prev[ch];
+		dx = ( dx > (int64_t) k_rise[ch] ) ? (int64_t) k_rise[ch] : dx;
+		dx = ( dx < -( (int64_t) k_fall[ch] )) ? -( (int64_t) k_fall[ch] ) : dx;
+
+		x_prev[ch] 	= (int32_t)( (int64_t) x_prev[ch] + dx );
+		p_y[ch]		= x_prev[ch];
+	}
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+* @} <!-- END GROUP -->
+*/
+////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*@addtogroup RATE_LIMITER_FIX_API
+* @{ <!-- BEGIN GROUP -->
+*
+* 	Following function are part or fixed point rate limiter API.
+*/
+////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////
+/*!
+* @brief    Initialize Q15 rate limiter
+*
+* @note Instance memory is provided by user. Slew rates are given in full
+* 		scale units per second, e.g. rise rate 0.5 ramps from zero to
+* 		full scale in 2 seconds.
+*
+* @param[out]  	p_inst		- Pointer to Q15 rate limiter instance
+* @param[in]  	rise_rate	- Rising slew rate
+* @param[in]  	fall_rate	- Falling slew rate
+* @param[in]  	dt			- Update (period) time
+* @return       status		- Either OK or Error
+*/
+////////////////////////////////////////////////////////////////////////////////
+rate_limiter_status_t rate_limiter_q15_init(rate_limiter_q15_t * const p_inst, const float32_t rise_rate, const float32_t fall_rate, const float32_t dt)
+{
+	rate_limiter_status_t status = eRATE_LIMITER_OK;
+
+	if 	(	( NULL != p_inst )
+		&& 	( dt > 0.0f ))
+	{
+		p_inst->x_prev = 0;
+		p_inst->k_rise = (int16_t) rate_limiter_fix_calc_rate_factor( dt, rise_rate, RATE_LIMITER_Q15_FULL_SCALE, INT16_MAX );
+		p_inst->k_fall = (int16_t) rate_limiter_fix_calc_rate_factor( dt, fall_rate, RATE_LIMITER_Q15_FULL_SCALE, INT16_MAX );
+
+		// Init success
+		p_inst->init = RATE_LIMITER_Q15_INIT_MAGIC;
+	}
+	else
+	{
+		status = eRATE_LIMITER_ERROR;
+	}
+
+	return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/*!
+* @brief    Update Q15 rate limiter
+*
+* @param[in]  	p_inst		- Pointer to Q15 rate limiter instance
+* @param[in]  	x			- Input signal
+* @return       y			- Output (slew limited) signal
+*/
+////////////////////////////////////////////////////////////////////////////////
+int16_t rate_limiter_q15_update(rate_limiter_q15_t * const p_inst, const int16_t x)
+{
+	int16_t y = 0;
+
+	// Check for instance and initialization
+	if ( NULL != p_inst )
+	{
+		if ( RATE_LIMITER_Q15_INIT_MAGIC == p_inst->init )
+		{
+			y = rate_limiter_q15_limit( x, p_inst->x_prev, p_inst->k_rise, p_inst->k_fall );
+
+			// Store current value
+			p_inst->x_prev = y;
+		}
+	}
+
+	return y;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/*!
+* @brief    Update Q15 rate limiter over block of samples
+*
+* @note Input and output buffer may point to the same location.
+*
+* @param[in]  	p_inst		- Pointer to Q15 rate limiter instance
+* @param[in]  	p_x			- Pointer to input signal samples
+* @param[out]  	p_y			- Pointer to output (slew limited) signal samples
+* @param[in]  	size		- Number of samples in block
+* @return       status		- Either OK or Error
+*/
+////////////////////////////////////////////////////////////////////////////////
+rate_limiter_status_t rate_limiter_q15_update_block(rate_limiter_q15_t * const p_inst, const int16_t * const p_x, int16_t * const p_y, const size_t size)
+{
+	rate_limiter_status_t 	status 	= eRATE_LIMITER_ERROR;
+	int16_t					x_prev	= 0;
+	size_t					i		= 0;
+
+	// Check for instance, initialization and buffers
+	if 	(	( NULL != p_inst )
+		&&	( NULL != p_x )
+		&&	( NULL != p_y ))
+	{
+		if ( RATE_LIMITER_Q15_INIT_MAGIC == p_inst->init )
+		{
+			x_prev = p_inst->x_prev;
+
+			for ( i = 0; i < size; i++ )
+			{
+				x_prev = rate_limiter_q15_limit( p_x[i], x_prev, p_inst->k_rise, p_inst->k_fall );
+				p_y[i] = x_prev;
+			}
+
+			p_inst->x_prev = x_prev;
+
+			status = eRATE_LIMITER_OK;
+		}
+	}
+
+	return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/*!
+* @brief    Get success initialization flag of Q15 rate limiter
+*
+* @param[in]  	p_inst		- Pointer to Q15 rate limiter instance
+* @return       is_init		- Success initialization flag
+*/
+////////////////////////////////////////////////////////////////////////////////
+bool rate_limiter_q15_is_init(const rate_limiter_q15_t * const p_inst)
+{
+	bool is_init = false;
+
+	if ( NULL != p_inst )
+	{
+		is_init = ( RATE_LIMITER_Q15_INIT_MAGIC == p_inst->init );
+	}
+
+	return is_init;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/*!
+* @brief    Change slew rate of Q15 rate limiter
+*
+* @note Slew rate has same units as with initialization function.
+*
+* @param[in]  	p_inst		- Pointer to Q15 rate limiter instance
+* @param[in]  	rise_rate	- Rising slew rate
+* @param[in]  	fall_rate	- Falling slew rate
+* @param[in]  	dt			- Update (period) time
+* @return       status		- Either OK or Error
+*/
+////////////////////////////////////////////////////////////////////////////////
+rate_limiter_status_t rate_limiter_q15_change_rate(rate_limiter_q15_t * const p_inst, const float32_t rise_rate, const float32_t fall_rate, const float32_t dt)
+{
+	rate_limiter_status_t status = eRATE_LIMITER_ERROR;
+
+	// Check for instance and initialization
+	if 	(	( true == rate_limiter_q15_is_init( p_inst ))
+		&&	( dt > 0.0f ))
+	{
+		p_inst->k_rise = (int16_t) rate_limiter_fix_calc_rate_factor( dt, rise_rate, RATE_LIMITER_Q15_FULL_SCALE, INT16_MAX );
+		p_inst->k_fall = (int16_t) rate_limiter_fix_calc_rate_factor( dt, fall_rate, RATE_LIMITER_Q15_FULL_SCALE, INT16_MAX );
+
+		status = eRATE_LIMITER_OK;
+	}
+
+	return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/*!
+* @brief    Initialize Q31 rate limiter
+*
+* @note Instance memory is provided by user. Slew rates are given in full
+* 		scale units per second, e.g. rise rate 0.5 ramps from zero to
+* 		full scale in 2 seconds.
+*
+* @param[out]  	p_inst		- Pointer to Q31 rate limiter instance
+* @param[in]  	rise_rate	- Rising slew rate
+* @param[in]  	fall_rate	- Falling slew rate
+* @param[in]  	dt			- Update (period) time
+* @return       status		- Either OK or Error
+*/
+////////////////////////////////////////////////////////////////////////////////
+rate_limiter_status_t rate_limiter_q31_init(rate_limiter_q31_t * const p_inst, const float32_t rise_rate, const float32_t fall_rate, const float32_t dt)
+{
+	rate_limiter_status_t status = eRATE_LIMITER_OK;
+
+	if 	(	( NULL != p_inst )
+		&& 	( dt > 0.0f ))
+	{
+		p_inst->x_prev = 0;
+		p_inst->k_rise = (int32_t) rate_limiter_fix_calc_rate_factor( dt, rise_rate, RATE_LIMITER_Q31_FULL_SCALE, INT32_MAX );
+		p_inst->k_fall = (int32_t) rate_limiter_fix_calc_rate_factor( dt, fall_rate, RATE_LIMITER_Q31_FULL_SCALE, INT32_MAX );
+
+		// Init success
+		p_inst->init = RATE_LIMITER_Q31_INIT_MAGIC;
+	}
+	else
+	{
+		status = eRATE_LIMITER_ERROR;
+	}
+
+	return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/*!
+* @brief    Update Q31 rate limiter
+*
+* @param[in]  	p_inst		- Pointer to Q31 rate limiter instance
+* @param[in]  	x			- Input signal
+* @return       y			- Output (slew limited) signal
+*/
+////////////////////////////////////////////////////////////////////////////////
+int32_t rate_limiter_q31_update(rate_limiter_q31_t * const p_inst, const int32_t x)
+{
+	int32_t y = 0;
+
+	// Check for instance and initialization
+	if ( NULL != p_inst )
+	{
+		if ( RATE_LIMITER_Q31_INIT_MAGIC == p_inst->init )
+		{
+			y = rate_limiter_q31_limit( x, p_inst->x_prev, p_inst->k_rise, p_inst->k_fall );
+
+			// Store current value
+			p_inst->x_prev = y;
+		}
+	}
+
+	return y;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/*!
+* @brief    Update Q31 rate limiter over block of samples
+*
+* @note Input and output buffer may point to the same location.
+*
+* @param[in]  	p_inst		- Pointer to Q31 rate limiter instance
+* @param[in]  	p_x			- Pointer to input signal samples
+* @param[out]  	p_y			- Pointer to output (slew limited) signal samples
+* @param[in]  	size		- Number of samples in block
+* @return       status		- Either OK or Error
+*/
+////////////////////////////////////////////////////////////////////////////////
+rate_limiter_status_t rate_limiter_q31_update_block(rate_limiter_q31_t * const p_inst, const int32_t * const p_x, int32_t * const p_y, const size_t size)
+{
+	rate_limiter_status_t 	status 	= eRATE_LIMITER_ERROR;
+	int32_t					x_prev	= 0;
+	size_t					i		= 0;
+
+	// Check for instance, initialization and buffers
+	if 	(	( NULL != p_inst )
+		&&	( NULL != p_x )
+		&&	( NULL != p_y ))
+	{
+		if ( RATE_LIMITER_Q31_INIT_MAGIC == p_inst->init )
+		{
+			x_prev = p_inst->x_prev;
+
+			for ( i = 0; i < size; i++ )
+			{
+				x_prev = rate_limiter_q31_limit( p_x[i], x_prev, p_inst->k_rise, p_inst->k_fall );
+				p_y[i] = x_prev;
+			}
+
+			p_inst->x_prev = x_prev;
+
+			status = eRATE_LIMITER_OK;
+		}
+	}
+
+	return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/*!
+* @brief    Get success initialization flag of Q31 rate limiter
+*
+* @param[in]  	p_inst		- Pointer to Q31 rate limiter instance
+* @return       is_init		- Success initialization flag
+*/
+////////////////////////////////////////////////////////////////////////////////
+bool rate_limiter_q31_is_init(const rate_limiter_q31_t * const p_inst)
+{
+	bool is_init = false;
+
+	if ( NULL != p_inst )
+	{
+		is_init = ( RATE_LIMITER_Q31_INIT_MAGIC == p_inst->init );
+	}
+
+	return is_init;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/*!
+* @brief    Change slew rate of Q31 rate limiter
+*
+* @note Slew rate has same units as with initialization function.
+*
+* @param[in]  	p_inst		- Pointer to Q31 rate limiter instance
+* @param[in]  	rise_rate	- Rising slew rate
+* @param[in]  	fall_rate	- Falling slew rate
+* @param[in]  	dt			- Update (period) time
+* @return       status		- Either OK or Error
+*/
+////////////////////////////////////////////////////////////////////////////////
+rate_limiter_status_t rate_limiter_q31_change_rate(rate_limiter_q31_t * const p_inst, const float32_t rise_rate, const float32_t fall_rate, const float32_t dt)
+{
+	rate_limiter_status_t status = eRATE_LIMITER_ERROR;
+
+	// Check for instance and initialization
+	if 	(	( true == rate_limiter_q31_is_init( p_inst ))
+		&&	( dt > 0.0f ))
+	{
+		p_inst->k_rise = (int32_t) rate_limiter_fix_calc_rate_factor( dt, rise_rate, RATE_LIMITER_Q31_FULL_SCALE, INT32_MAX );
+		p_inst->k_fall = (int32_t) rate_limiter_fix_calc_rate_factor( dt, fall_rate, RATE_LIMITER_Q31_FULL_SCALE, INT32_MAX );
+
+		status = eRATE_LIMITER_OK;
+	}
+
+	return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/*!
+* @brief    Initialize Q15 rate limiter bank
+*
+* @note All channels are initialized with the same rising/falling slew
+* 		rate, given in full scale units per second.
+*
+* @param[out]  	p_bank		- Pointer to Q15 rate limiter bank
+* @param[in]  	num_of_ch	- Number of channels
+* @param[in]  	rise_rate	- Rising slew rate
+* @param[in]  	fall_rate	- Falling slew rate
+* @param[in]  	dt			- Update (period) time
+* @return       status		- Either OK or Error
+*/
+////////////////////////////////////////////////////////////////////////////////
+rate_limiter_status_t rate_limiter_q15_bank_init(p_rate_limiter_q15_bank_t * p_bank, const uint32_t num_of_ch, const float32_t rise_rate, const float32_t fall_rate, const float32_t dt)
+{
+	rate_limiter_status_t 	status 		= eRATE_LIMITER_OK;
+	uint32_t				stride		= 0;
+	uintptr_t				addr		= 0;
+	int16_t					k_rise		= 0;
+	int16_t					k_fall		= 0;
+	uint32_t				ch			= 0;
+
+	#if ( 1 == RATE_LIMITER_BANK_SIMD_EN )
+		pf_rate_limiter_q15_bank_kernel_t pf_simd = NULL;
+	#endif
+
+	if 	(	( NULL != p_bank )
+		&&	( num_of_ch > 0U )
+		&& 	( dt > 0.0f ))
+	{
+		// Allocate space
+		*p_bank = malloc( sizeof( rate_limiter_q15_bank_t ));
+
+		if ( NULL != *p_bank )
+		{
+			// Round array length up to whole aligned blocks
+			stride = (( num_of_ch + RATE_LIMITER_Q15_CH_PER_ALIGN - 1U ) / RATE_LIMITER_Q15_CH_PER_ALIGN ) * RATE_LIMITER_Q15_CH_PER_ALIGN;
+
+			// Allocate all arrays as single block with spare space for alignment
+			(*p_bank)->p_mem = malloc(( 3U * stride * sizeof( int16_t )) + RATE_LIMITER_BANK_ALIGN );
+
+			if ( NULL != (*p_bank)->p_mem )
+			{
+				// Align arrays
+				addr = ((uintptr_t) (*p_bank)->p_mem + RATE_LIMITER_BANK_ALIGN - 1U ) & ~((uintptr_t) RATE_LIMITER_BANK_ALIGN - 1U );
+
+				(*p_bank)->p_x_prev = (int16_t*) addr;
+				(*p_bank)->p_k_rise = (*p_bank)->p_x_prev + stride;
+				(*p_bank)->p_k_fall = (*p_bank)->p_k_rise + stride;
+
+				// Calculate rise/fall factors
+				k_rise = (int16_t) rate_limiter_fix_calc_rate_factor( dt, rise_rate, RATE_LIMITER_Q15_FULL_SCALE, INT16_MAX );
+				k_fall = (int16_t) rate_limiter_fix_calc_rate_factor( dt, fall_rate, RATE_LIMITER_Q15_FULL_SCALE, INT16_MAX );
+
+				// Init channels
+				for ( ch = 0; ch < stride; ch++ )
+				{
+					(*p_bank)->p_x_prev[ch] = 0;
+					(*p_bank)->p_k_rise[ch] = k_rise;
+					(*p_bank)->p_k_fall[ch] = k_fall;
+				}
+
+				(*p_bank)->dt = dt;
+				(*p_bank)->num_of_ch = num_of_ch;
+
+				// Select update kernel
+				(*p_bank)->pf_kernel = &rate_limiter_q15_bank_update_kernel;
+
+				#if ( 1 == RATE_LIMITER_BANK_SIMD_EN )
+					pf_simd = rate_limiter_simd_get_q15_bank_kernel();
+
+					if ( NULL != pf_simd )
+					{
+						(*p_bank)->pf_kernel = pf_simd;
+					}
+				#endif
+
+				// Init success
+				(*p_bank)->is_init = true;
+			}
+			else
+			{
+				free( *p_bank );
+				*p_bank = NULL;
+
+				status = eRATE_LIMITER_ERROR;
+			}
+		}
+		else
+		{
+			status = eRATE_LIMITER_ERROR;
+		}
+	}
+	else
+	{
+		status = eRATE_LIMITER_ERROR;
+	}
+
+	return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/*!
+* @brief    De-initialize Q15 rate limiter bank
+*
+* @param[in,out]  	p_bank		- Pointer to Q15 rate limiter bank
+* @return       	status		- Either OK or Error
+*/
+////////////////////////////////////////////////////////////////////////////////
+rate_limiter_status_t rate_limiter_q15_bank_deinit(p_rate_limiter_q15_bank_t * p_bank)
+{
+	rate_limiter_status_t status = eRATE_LIMITER_ERROR;
+
+	// Check for bank and initialization
+	if ( NULL != p_bank )
+	{
+		if ( true == rate_limiter_q15_bank_is_init( *p_bank ))
+		{
+			(*p_bank)->is_init = false;
+
+			free( (*p_bank)->p_mem );
+			free( *p_bank );
+
+			*p_bank = NULL;
+
+			status = eRATE_LIMITER_OK;
+		}
+	}
+
+	return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/*!
+* @brief    Update all channels of Q15 rate limiter bank
+*
+* @note Input and output buffer must hold at least number of channels
+* 		samples and may point to the same location.
+*
+* @param[in]  	bank		- Pointer to Q15 rate limiter bank
+* @param[in]  	p_x			- Pointer to input signals, one per channel
+* @param[out]  	p_y			- Pointer to output (slew limited) signals, one per channel
+* @return       status		- Either OK or Error
+*/
+////////////////////////////////////////////////////////////////////////////////
+rate_limiter_status_t rate_limiter_q15_bank_update(p_rate_limiter_q15_bank_t bank, const int16_t * const p_x, int16_t * const p_y)
+{
+	rate_limiter_status_t status = eRATE_LIMITER_ERROR;
+
+	// Check for bank, initialization and buffers
+	if 	(	( NULL != bank )
+		&&	( NULL != p_x )
+		&&	( NULL != p_y ))
+	{
+		if ( true == bank->is_init )
+		{
+			bank->pf_kernel( p_x, p_y, bank->p_x_prev, bank->p_k_rise, bank->p_k_fall, bank->num_of_ch );
+
+			status = eRATE_LIMITER_OK;
+		}
+	}
+
+	return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/*!
+* @brief    Get success initialization flag of Q15 rate limiter bank
+*
+* @param[in]  	bank		- Pointer to Q15 rate limiter bank
+* @return       is_init		- Success initialization flag
+*/
+////////////////////////////////////////////////////////////////////////////////
+bool rate_limiter_q15_bank_is_init(p_rate_limiter_q15_bank_t bank)
+{
+	bool is_init = false;
+
+	if ( NULL != bank )
+	{
+		is_init = bank->is_init;
+	}
+
+	return is_init;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/*!
+* @brief    Change slew rate of single Q15 bank channel
+*
+* @param[in]  	bank		- Pointer to Q15 rate limiter bank
+* @param[in]  	ch			- Channel index
+* @param[in]  	rise_rate	- Rising slew rate
+* @param[in]  	fall_rate	- Falling slew rate
+* @return       status		- Either OK or Error
+*/
+////////////////////////////////////////////////////////////////////////////////
+rate_limiter_status_t rate_limiter_q15_bank_change_rate(p_rate_limiter_q15_bank_t bank, const uint32_t ch, const float32_t rise_rate, const float32_t fall_rate)
+{
+	rate_limiter_status_t status = eRATE_LIMITER_ERROR;
+
+	// Check for bank, initialization and channel
+	if ( NULL != bank )
+	{
+		if 	(	( true == bank->is_init )
+			&&	( ch < bank->num_of_ch ))
+		{
+			bank->p_k_rise[ch] = (int16_t) rate_limiter_fix_calc_rate_factor( bank->dt, rise_rate, RATE_LIMITER_Q15_FULL_SCALE, INT16_MAX );
+			bank->p_k_fall[ch] = (int16_t) rate_limiter_fix_calc_rate_factor( bank->dt, fall_rate, RATE_LIMITER_Q15_FULL_SCALE, INT16_MAX );
+
+			status = eRATE_LIMITER_OK;
+		}
+	}
+
+	return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/*!
+* @brief    Initialize Q31 rate limiter bank
+*
+* @note All channels are initialized with the same rising/falling slew
+* 		rate, given in full scale units per second.
+*
+* @param[out]  	p_bank		- Pointer to Q31 rate limiter bank
+* @param[in]  	num_of_ch	- Number of channels
+* @param[in]  	rise_rate	- Rising slew rate
+* @param[in]  	fall_rate	- Falling slew rate
+* @param[in]  	dt			- Update (period) time
+* @return       status		- Either OK or Error
+*/
+////////////////////////////////////////////////////////////////////////////////
+rate_limiter_status_t rate_limiter_q31_bank_init(p_rate_limiter_q31_bank_t * p_bank, const uint32_t num_of_ch, const float32_t rise_rate, const float32_t fall_rate, const float32_t dt)
+{
+	rate_limiter_status_t 	status 		= eRATE_LIMITER_OK;
+	uint32_t				stride		= 0;
+	uintptr_t				addr		= 0;
+	int32_t					k_rise		= 0;
+	int32_t					k_fall		= 0;
+	uint32_t				ch			= 0;
+
+	if 	(	( NULL != p_bank )
+		&&	( num_of_ch > 0U )
+		&& 	( dt > 0.0f ))
+	{
+		// Allocate space
+		*p_bank = malloc( sizeof( rate_limiter_q31_bank_t ));
+
+		if ( NULL != *p_bank )
+		{
+			// Round array length up to whole aligned blocks
+			stride = (( num_of_ch + RATE_LIMITER_Q31_CH_PER_ALIGN - 1U ) / RATE_LIMITER_Q31_CH_PER_ALIGN ) * RATE_LIMITER_Q31_CH_PER_ALIGN;
+
+			// Allocate all arrays as single block with spare space for alignment
+			(*p_bank)->p_mem = malloc(( 3U * stride * sizeof( int32_t )) + RATE_LIMITER_BANK_ALIGN );
+
+			if ( NULL != (*p_bank)->p_mem )
+			{
+				// Align arrays
+				addr = ((uintptr_t) (*p_bank)->p_mem + RATE_LIMITER_BANK_ALIGN - 1U ) & ~((uintptr_t) RATE_LIMITER_BANK_ALIGN - 1U );
+
+				(*p_bank)->p_x_prev = (int32_t*) addr;
+				(*p_bank)->p_k_rise = (*p_bank)->p_x_prev + stride;
+				(*p_bank)->p_k_fall = (*p_bank)->p_k_rise + stride;
+
+				// Calculate rise/fall factors
+				k_rise = (int32_t) rate_limiter_fix_calc_rate_factor( dt, rise_rate, RATE_LIMITER_Q31_FULL_SCALE, INT32_MAX );
+				k_fall = (int32_t) rate_limiter_fix_calc_rate_factor( dt, fall_rate, RATE_LIMITER_Q31_FULL_SCALE, INT32_MAX );
+
+				// Init channels
+				for ( ch = 0; ch < stride; ch++ )
+				{
+					(*p_bank)->p_x_prev[ch] = 0;
+					(*p_bank)->p_k_rise[ch] = k_rise;
+					(*p_bank)->p_k_fall[ch] = k_fall;
+				}
+
+				(*p_bank)->dt = dt;
+				(*p_bank)->num_of_ch = num_of_ch;
+
+				// Init success
+				(*p_bank)->is_init = true;
+			}
+			else
+			{
+				free( *p_bank );
+				*p_bank = NULL;
+
+				status = eRATE_LIMITER_ERROR;
+			}
+		}
+		else
+		{
+			status = eRATE_LIMITER_ERROR;
+		}
+	}
+	else
+	{
+		status = eRATE_LIMITER_ERROR;
+	}
+
+	return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/*!
+* @brief    De-initialize Q31 rate limiter bank
+*
+* @param[in,out]  	p_bank		- Pointer to Q31 rate limiter bank
+* @return       	status		- Either OK or Error
+*/
+////////////////////////////////////////////////////////////////////////////////
+rate_limiter_status_t rate_limiter_q31_bank_deinit(p_rate_limiter_q31_bank_t * p_bank)
+{
+	rate_limiter_status_t status = eRATE_LIMITER_ERROR;
+
+	// Check for bank and initialization
+	if ( NULL != p_bank )
+	{
+		if ( true == rate_limiter_q31_bank_is_init( *p_bank ))
+		{
+			(*p_bank)->is_init = false;
+
+			free( (*p_bank)->p_mem );
+			free( *p_bank );
+
+			*p_bank = NULL;
+
+			status = eRATE_LIMITER_OK;
+		}
+	}
+
+	return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/*!
+* @brief    Update all channels of Q31 rate limiter bank
+*
+* @note Input and output buffer must hold at least number of channels
+* 		samples and may point to the same location.
+*
+* @param[in]  	bank		- Pointer to Q31 rate limiter bank
+* @param[in]  	p_x			- Pointer to input signals, one per channel
+* @param[out]  	p_y			- Pointer to output (slew limited) signals, one per channel
+* @return       status		- Either OK or Error
+*/
+////////////////////////////////////////////////////////////////////////////////
+rate_limiter_status_t rate_limiter_q31_bank_update(p_rate_limiter_q31_bank_t bank, const int32_t * const p_x, int32_t * const p_y)
+{
+	rate_limiter_status_t status = eRATE_LIMITER_ERROR;
+
+	// Check for bank, initialization and buffers
+	if 	(	( NULL != bank )
+		&&	( NULL != p_x )
+		&&	( NULL != p_y ))
+	{
+		if ( true == bank->is_init )
+		{
+			rate_limiter_q31_bank_update_kernel( p_x, p_y, bank->p_x_prev, bank->p_k_rise, bank->p_k_fall, bank->num_of_ch );
+
+			status = eRATE_LIMITER_OK;
+		}
+	}
+
+	return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/*!
+* @brief    Get success initialization flag of Q31 rate limiter bank
+*
+* @param[in]  	bank		- Pointer to Q31 rate limiter bank
+* @return       is_init		- Success initialization flag
+*/
+////////////////////////////////////////////////////////////////////////////////
+bool rate_limiter_q31_bank_is_init(p_rate_limiter_q31_bank_t bank)
+{
+	bool is_init = false;
+
+	if ( NULL != bank )
+	{
+		is_init = bank->is_init;
+	}
+
+	return is_init;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/*!
+* @brief    Change slew rate of single Q31 bank channel
+*
+* @param[in]  	bank		- Pointer to Q31 rate limiter bank
+* @param[in]  	ch			- Channel index
+* @param[in]  	rise_rate	- Rising slew rate
+* @param[in]  	fall_rate	- Falling slew rate
+* @return       status		- Either OK or Error
+*/
+////////////////////////////////////////////////////////////////////////////////
+rate_limiter_status_t rate_limiter_q31_bank_change_rate(p_rate_limiter_q31_bank_t bank, const uint32_t ch, const float32_t rise_rate, const float32_t fall_rate)
+{
+	rate_limiter_status_t status = eRATE_LIMITER_ERROR;
+
+	// Check for bank, initialization and channel
+	if ( NULL != bank )
+	{
+		if 	(	( true == bank->is_init )
+			&&	( ch < bank->num_of_ch ))
+		{
+			bank->p_k_rise[ch] = (int32_t) rate_limiter_fix_calc_rate_factor( bank->dt, rise_rate, RATE_LIMITER_Q31_FULL_SCALE, INT32_MAX );
+			bank->p_k_fall[ch] = (int32_t) rate_limiter_fix_calc_rate_factor( bank->dt, fall_rate, RATE_LIMITER_Q31_FULL_SCALE, INT32_MAX );
+
+			status = eRATE_LIMITER_OK;
+		}
+	}
+
+	return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+* @} <!-- END GROUP -->
+*/
+////////////////////////////////////////////////////////////////////////////////
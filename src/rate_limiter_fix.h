@@ -0,0 +1,103 @@
+// Copyright (c) 2021 Ziga Miklosic
+// All Rights Reserved
+// This software is under MIT licence (https://opensource.org/licenses/MIT)
+////////////////////////////////////////////////////////////////////////////////
+/**
+*@file      rate_limiter_fix.h
+*@brief     Fixed point (Q15/Q31) rate limiter
+*@author    Ziga Miklosic
+*@date      19.02.2021
+*@version   V1.1.0
+*/
+////////////////////////////////////////////////////////////////////////////////
+/**
+*@addtogroup RATE_LIMITER_FIX_API
+* @{ <!-- BEGIN GROUP -->
+*
+*/
+////////////////////////////////////////////////////////////////////////////////
+
+#ifndef __RATE_LIMITER_FIX_H
+#define __RATE_LIMITER_FIX_H
+
+////////////////////////////////////////////////////////////////////////////////
+// Includes
+////////////////////////////////////////////////////////////////////////////////
+#include "rate_limiter.h"
+
+////////////////////////////////////////////////////////////////////////////////
+// Definitions
+////////////////////////////////////////////////////////////////////////////////
+
+/**
+ * 	Q15 slew rate limiter
+ *
+ * @note Instance is owned by user and fields shall only be accessed by
+ * 		"rate_limiter_q15_" functions.
+ */
+typedef struct
+{
+	int16_t		x_prev;		/**<Previous value of input */
+	int16_t		k_rise;		/**<Rising slew rate factor */
+	int16_t		k_fall;		/**<Falling slew rate factor */
+	uint16_t	init;		/**<Initialization sentinel */
+} rate_limiter_q15_t;
+
+/**
+ * 	Q31 slew rate limiter
+ *
+ * @note Instance is owned by user and fields shall only be accessed by
+ * 		"rate_limiter_q31_" functions.
+ */
+typedef struct
+{
+	int32_t		x_prev;		/**<Previous value of input */
+	int32_t		k_rise;		/**<Rising slew rate factor */
+	int32_t		k_fall;		/**<Falling slew rate factor */
+	uint32_t	init;		/**<Initialization sentinel */
+} rate_limiter_q31_t;
+
+/**
+ * 	Pointer to Q15 rate limiter bank
+ */
+typedef struct rate_limiter_q15_bank_s * p_rate_limiter_q15_bank_t;
+
+/**
+ * 	Pointer to Q31 rate limiter bank
+ */
+typedef struct rate_limiter_q31_bank_s * p_rate_limiter_q31_bank_t;
+
+////////////////////////////////////////////////////////////////////////////////
+// Functions
+////////////////////////////////////////////////////////////////////////////////
+rate_limiter_status_t	rate_limiter_q15_init			(rate_limiter_q15_t * const p_inst, const float32_t rise_rate, const float32_t fall_rate, const float32_t dt);
+int16_t					rate_limiter_q15_update			(rate_limiter_q15_t * const p_inst, const int16_t x);
+rate_limiter_status_t	rate_limiter_q15_update_block	(rate_limiter_q15_t * const p_inst, const int16_t * const p_x, int16_t * const p_y, const size_t size);
+bool					rate_limiter_q15_is_init		(const rate_limiter_q15_t * const p_inst);
+rate_limiter_status_t	rate_limiter_q15_change_rate	(rate_limiter_q15_t * const p_inst, const float32_t rise_rate, const float32_t fall_rate, const float32_t dt);
+
+rate_limiter_status_t	rate_limiter_q31_init			(rate_limiter_q31_t * const p_inst, const float32_t rise_rate, const float32_t fall_rate, const float32_t dt);
+int32_t					rate_limiter_q31_update			(rate_limiter_q31_t * const p_inst, const int32_t x);
+rate_limiter_status_t	rate_limiter_q31_update_block	(rate_limiter_q31_t * const p_inst, const int32_t * const p_x, int32_t * const p_y, const size_t size);
+bool					rate_limiter_q31_is_init		(const rate_limiter_q31_t * const p_inst);
+rate_limiter_status_t	rate_limiter_q31_change_rate	(rate_limiter_q31_t * const p_inst, const float32_t rise_rate, const float32_t fall_rate, const float32_t dt);
+
+rate_limiter_status_t	rate_limiter_q15_bank_init			(p_rate_limiter_q15_bank_t * p_bank, const uint32_t num_of_ch, const float32_t rise_rate, const float32_t fall_rate, const float32_t dt);
+rate_limiter_status_t	rate_limiter_q15_bank_deinit		(p_rate_limiter_q15_bank_t * p_bank);
+rate_limiter_status_t	rate_limiter_q15_bank_update		(p_rate_limiter_q15_bank_t bank, const int16_t * const p_x, int16_t * const p_y);
+bool					rate_limiter_q15_bank_is_init		(p_rate_limiter_q15_bank_t bank);
+rate_limiter_status_t	rate_limiter_q15_bank_change_rate	(p_rate_limiter_q15_bank_t bank, const uint32_t ch, const float32_t rise_rate, const float32_t fall_rate);
+
+rate_limiter_status_t	rate_limiter_q31_bank_init			(p_rate_limiter_q31_bank_t * p_bank, const uint32_t num_of_ch, const float32_t rise_rate, const float32_t fall_rate, const float32_t dt);
+rate_limiter_status_t	rate_limiter_q31_bank_deinit		(p_rate_limiter_q31_bank_t * p_bank);
+rate_limiter_status_t	rate_limiter_q31_bank_update		(p_rate_limiter_q31_bank_t bank, const int32_t * const p_x, int32_t * const p_y);
+bool					rate_limiter_q31_bank_is_init		(p_rate_limiter_q31_bank_t bank);
+rate_limiter_status_t	rate_limiter_q31_bank_change_rate	(p_rate_limiter_q31_bank_t bank, const uint32_t ch, const float32_t rise_rate, const float32_t fall_rate);
+
+#endif // __RATE_LIMITER_FIX_H
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+* @} <!-- END GROUP -->
+*/
+////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,112 @@
+// Copyright (c) 2021 Ziga Miklosic
+// All Rights Reserved
+// This software is under MIT licence (https://opensource.org/licenses/MIT)
+////////////////////////////////////////////////////////////////////////////////
+/**
+*@file      rate_limiter_generic.h
+*@brief     Type generic rate limiter front end
+*@author    Ziga Miklosic
+*@date      19.02.2021
+*@version   V1.1.0
+*
+*@note		Requires C11 "_Generic". Macros select precision specific
+*			function from type of instance, so each precision keeps its
+*			own kernel and no conversion cost is added.
+*/
+////////////////////////////////////////////////////////////////////////////////
+/**
+*@addtogroup RATE_LIMITER_GENERIC_API
+* @{ <!-- BEGIN GROUP -->
+*
+*/
+////////////////////////////////////////////////////////////////////////////////
+
+#ifndef __RATE_LIMITER_GENERIC_H
+#define __RATE_LIMITER_GENERIC_H
+
+////////////////////////////////////////////////////////////////////////////////
+// Includes
+////////////////////////////////////////////////////////////////////////////////
+#include "rate_limiter.h"
+#include "rate_limiter_f64.h"
+#include "rate_limiter_fix.h"
+#include "rate_limiter_bank.h"
+#include "rate_limiter_bank16.h"
+
+////////////////////////////////////////////////////////////////////////////////
+// Definitions
+////////////////////////////////////////////////////////////////////////////////
+
+#if defined( __STDC_VERSION__ ) && ( __STDC_VERSION__ >= 201112L )
+
+/**
+ * 	Update rate limiter of any precision
+ *
+ * @param[in]	inst	- Rate limiter instance (p_rate_limiter_t or pointer to user owned instance)
+ * @param[in]	x		- Input signal in precision of instance
+ */
+#define rate_limiter_step(inst, x)										\
+	_Generic(( inst ),													\
+		p_rate_limiter_t:			rate_limiter_update,				\
+		rate_limiter_compact_t *:	rate_limiter_compact_update,		\
+		rate_limiter_f64_t *:		rate_limiter_f64_update,			\
+		rate_limiter_q15_t *:		rate_limiter_q15_update,			\
+		rate_limiter_q31_t *:		rate_limiter_q31_update				\
+	)(( inst ), ( x ))
+
+/**
+ * 	Update rate limiter of any precision over block of samples
+ *
+ * @param[in]	inst	- Rate limiter instance (p_rate_limiter_t or pointer to user owned instance)
+ * @param[in]	p_x		- Pointer to input signal samples
+ * @param[out]	p_y		- Pointer to output signal samples
+ * @param[in]	size	- Number of samples in block
+ */
+#define rate_limiter_step_block(inst, p_x, p_y, size)					\
+	_Generic(( inst ),													\
+		p_rate_limiter_t:			rate_limiter_update_block,			\
+		rate_limiter_compact_t *:	rate_limiter_compact_update_block,	\
+		rate_limiter_f64_t *:		rate_limiter_f64_update_block,		\
+		rate_limiter_q15_t *:		rate_limiter_q15_update_block,		\
+		rate_limiter_q31_t *:		rate_limiter_q31_update_block		\
+	)(( inst ), ( p_x ), ( p_y ), ( size ))
+
+/**
+ * 	Get success initialization flag of rate limiter of any precision
+ *
+ * @param[in]	inst	- Rate limiter instance (p_rate_limiter_t or pointer to user owned instance)
+ */
+#define rate_limiter_ready(inst)										\
+	_Generic(( inst ),													\
+		p_rate_limiter_t:			rate_limiter_is_init,				\
+		rate_limiter_compact_t *:	rate_limiter_compact_is_init,		\
+		rate_limiter_f64_t *:		rate_limiter_f64_is_init,			\
+		rate_limiter_q15_t *:		rate_limiter_q15_is_init,			\
+		rate_limiter_q31_t *:		rate_limiter_q31_is_init			\
+	)( inst )
+
+/**
+ * 	Update all channels of rate limiter bank of any precision
+ *
+ * @param[in]	bank	- Rate limiter bank
+ * @param[in]	p_x		- Pointer to input signals, one per channel
+ * @param[out]	p_y		- Pointer to output signals, one per channel
+ */
+#define rate_limiter_bank_step(bank, p_x, p_y)							\
+	_Generic(( bank ),													\
+		p_rate_limiter_bank_t:		rate_limiter_bank_update,			\
+		p_rate_limiter_f64_bank_t:	rate_limiter_f64_bank_update,		\
+		p_rate_limiter_bank16_t:	rate_limiter_bank16_update,			\
+		p_rate_limiter_q15_bank_t:	rate_limiter_q15_bank_update,		\
+		p_rate_limiter_q31_bank_t:	rate_limiter_q31_bank_update		\
+	)(( bank ), ( p_x ), ( p_y ))
+
+#endif // __STDC_VERSION__ >= 201112L
+
+#endif // __RATE_LIMITER_GENERIC_H
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+* @} <!-- END GROUP -->
+*/
+////////////////////////////////////////////////////////////////////////////////
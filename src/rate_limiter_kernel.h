@@ -0,0 +1,657 @@
+// Copyright (c) 2021 Ziga Miklosic
+// All Rights Reserved
+// This software is under MIT licence (https://opensource.org/licenses/MIT)
+////////////////////////////////////////////////////////////////////////////////
+/**
+*@file      rate_limiter_kernel.h
+*@brief     Rate limiter core computation, shared between all update paths
+*@author    Ziga Miklosic
+*@date      19.02.2021
+*@version   V1.1.0
+*
+*@note		This is private header of rate limiter module and shall not be
+*			included by user code.
+*/
+////////////////////////////////////////////////////////////////////////////////
+/*!
+* @addtogroup RATE_LIMITER
+* @{ <!-- BEGIN GROUP -->
+*/
+////////////////////////////////////////////////////////////////////////////////
+
+#ifndef __RATE_LIMITER_KERNEL_H
+#define __RATE_LIMITER_KERNEL_H
+
+////////////////////////////////////////////////////////////////////////////////
+// Includes
+////////////////////////////////////////////////////////////////////////////////
+#include "rate_limiter.h"
+
+////////////////////////////////////////////////////////////////////////////////
+// Definitions
+////////////////////////////////////////////////////////////////////////////////
+
+/**
+ * 	Raw bit access to float value
+ */
+typedef union
+{
+	float32_t	f;	/**<Float value */
+	uint32_t	u;	/**<Raw bits */
+} rate_limiter_bits_t;
+
+/**
+ * 	Resolution of 16-bit float sub-ulp remainder, 2^-15 ulp
+ */
+#define RATE_LIMITER_H16_RES_LSB		( 3.0517578125e-05f )
+
+/**
+ * 	Range of 16-bit float sub-ulp remainder, one ulp
+ */
+#define RATE_LIMITER_H16_RES_MAX		( 32768.0f )
+
+////////////////////////////////////////////////////////////////////////////////
+// Functions
+////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////
+/*!
+* @brief    Calculate slew rate factor base on update time.
+*
+* @param[in]  	dt			- Update (period) time
+* @param[in]	slew_rate	- Wanted slew rate
+* @return       k_rate		- Slew rate factor
+*/
+////////////////////////////////////////////////////////////////////////////////
+static inline float32_t rate_limiter_calc_rate_factor(const float32_t dt, const float32_t slew_rate)
+{
+	float32_t k_rate = 0.0f;
+
+	k_rate = ( slew_rate * dt );
+
+	return k_rate;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/*!
+* @brief    Fill snapshot header
+*
+* @param[out]  	p_header	- Pointer to snapshot header
+* @param[in]  	type		- Snapshot type
+* @param[in]  	num_of_ch	- Number of channels
+* @param[in]  	stride		- Length of channel arrays
+* @param[in]  	size		- Snapshot size in bytes
+* @param[in]  	dt			- Period of update
+* @return       void
+*/
+////////////////////////////////////////////////////////////////////////////////
+static inline void rate_limiter_snapshot_set_header(rate_limiter_snapshot_header_t * const p_header, const rate_limiter_snapshot_type_t type, const uint32_t num_of_ch, const uint32_t stride, const uint64_t size, const float32_t dt)
+{
+	uint32_t i = 0;
+
+	p_header->magic = RATE_LIMITER_SNAPSHOT_MAGIC;
+	p_header->version = RATE_LIMITER_SNAPSHOT_VERSION;
+	p_header->type = (uint16_t) type;
+	p_header->num_of_ch = num_of_ch;
+	p_header->stride = stride;
+	p_header->size = size;
+	p_header->dt = dt;
+
+	for ( i = 0; i < ( sizeof( p_header->reserved ) / sizeof( p_header->reserved[0] )); i++ )
+	{
+		p_header->reserved[i] = 0U;
+	}
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/*!
+* @brief    Check snapshot header
+*
+* @note Rejects other byte order, other format version, other type,
+* 		channel count mismatch and truncated snapshot.
+*
+* @param[in]  	p_header	- Pointer to snapshot header
+* @param[in]  	type		- Expected snapshot type
+* @param[in]  	num_of_ch	- Expected number of channels
+* @param[in]  	size		- Available snapshot size in bytes
+* @return       valid		- True when snapshot can be restored
+*/
+////////////////////////////////////////////////////////////////////////////////
+static inline bool rate_limiter_snapshot_check_header(const rate_limiter_snapshot_header_t * const p_header, const rate_limiter_snapshot_type_t type, const uint32_t num_of_ch, const uint64_t size)
+{
+	return 	(	( RATE_LIMITER_SNAPSHOT_MAGIC == p_header->magic )
+			&&	( RATE_LIMITER_SNAPSHOT_VERSION == p_header->version )
+			&&	((uint16_t) type == p_header->type )
+			&&	( num_of_ch == p_header->num_of_ch )
+			&&	( p_header->stride >= num_of_ch )
+			&&	( p_header->size <= size )
+			&&	( p_header->dt > 0.0f ));
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/*!
+* @brief    Branchless select between two values
+*
+* @note Selection is done with bit masks on raw float representation.
+* 		Unlike "?:" operator on floating point compare, this is never
+* 		turned into branch by compiler (e.g. GCC with trapping math).
+*
+* @param[in]  	cond		- Selection condition
+* @param[in]  	a			- Value selected when condition is true
+* @param[in]  	b			- Value selected when condition is false
+* @return       y			- Selected value
+*/
+////////////////////////////////////////////////////////////////////////////////
+static inline float32_t rate_limiter_select(const bool cond, const float32_t a, const float32_t b)
+{
+	const uint32_t mask = ( 0U - (uint32_t) cond );
+	rate_limiter_bits_t a_bits;
+	rate_limiter_bits_t b_bits;
+	rate_limiter_bits_t y_bits;
+
+	a_bits.f = a;
+	b_bits.f = b;
+
+	y_bits.u = (( a_bits.u & mask ) | ( b_bits.u & ~mask ));
+
+	return y_bits.f;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/*!
+* @brief    Slew limit input signal against previous output, select form
+*
+* @note Gives bit exact result as "rate_limiter_limit()" but without any
+* 		control flow. Both limited values are always computed and selected
+* 		afterwards with bitwise select, so that compiler emits branchless
+* 		code and can vectorize loops using it.
+*
+* 		Rising limit is selected last as it has precedence in
+* 		"rate_limiter_limit()".
+*
+* @param[in]  	x			- Input signal
+* @param[in]  	x_prev		- Previous output signal
+* @param[in]  	k_rise		- Rising slew rate factor
+* @param[in]  	k_fall		- Falling slew rate factor
+* @return       y			- Output (slew limited) signal
+*/
+////////////////////////////////////////////////////////////////////////////////
+static inline float32_t rate_limiter_limit_sel(const float32_t x, const float32_t x_prev, const float32_t k_rise, const float32_t k_fall)
+{
+	const float32_t dx 		= x - x_prev;
+	const float32_t y_rise 	= x_prev + k_rise;
+	const float32_t y_fall 	= x_prev - k_fall;
+	float32_t		y		= 0.0f;
+
+	y = rate_limiter_select(( dx <= -( k_fall )), y_fall, x );
+	y = rate_limiter_select(( dx >= k_rise ), y_rise, y );
+
+	return y;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/*!
+* @brief    Slew limit input signal against previous output
+*
+* @note This is the core of the rate limiter and is shared between all
+* 		update paths (single sample, block & bank), so that all of them
+* 		give bit exact results.
+*
+* 		With RATE_LIMITER_BRANCHLESS_EN enabled select form is used.
+*
+* @param[in]  	x			- Input signal
+* @param[in]  	x_prev		- Previous output signal
+* @param[in]  	k_rise		- Rising slew rate factor
+* @param[in]  	k_fall		- Falling slew rate factor
+* @return       y			- Output (slew limited) signal
+*/
+////////////////////////////////////////////////////////////////////////////////
+static inline float32_t rate_limiter_limit(const float32_t x, const float32_t x_prev, const float32_t k_rise, const float32_t k_fall)
+{
+	float32_t y = 0.0f;
+
+#if ( 1 == RATE_LIMITER_BRANCHLESS_EN )
+
+	y = rate_limiter_limit_sel( x, x_prev, k_rise, k_fall );
+
+#else
+
+	float32_t dx = 0.0f;
+
+	// Calculate change
+	dx = x - x_prev;
+
+	// Rising limit
+	if ( dx >= k_rise )
+	{
+		y = x_prev + k_rise;
+	}
+
+	// Falling limit
+	else if ( dx <= -( k_fall ))
+	{
+		y = x_prev - k_fall;
+	}
+
+	// No limitations...
+	else
+	{
+		y = x;
+	}
+
+#endif
+
+	return y;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/*!
+* @brief    Slew limit constant input signal over multiple steps
+*
+* @note Closed form of applying "rate_limiter_limit()" n_steps times with
+* 		the same input. Output moves towards input by at most n_steps
+* 		rising or falling factors. For n_steps = 1 result is bit exact to
+* 		single step, otherwise it is exact in real arithmetic but may
+* 		differ from iterated steps in rounding of last bits.
+*
+* 		Slew rate factors are expected to be non-negative.
+*
+* @param[in]  	x			- Input signal
+* @param[in]  	x_prev		- Previous output signal
+* @param[in]  	k_rise		- Rising slew rate factor
+* @param[in]  	k_fall		- Falling slew rate factor
+* @param[in]  	n_steps		- Number of steps
+* @return       y			- Output (slew limited) signal after n_steps
+*/
+////////////////////////////////////////////////////////////////////////////////
+static inline float32_t rate_limiter_limit_n(const float32_t x, const float32_t x_prev, const float32_t k_rise, const float32_t k_fall, const uint32_t n_steps)
+{
+	const float32_t n = (float32_t) n_steps;
+
+	return rate_limiter_limit( x, x_prev, ( n * k_rise ), ( n * k_fall ));
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/*!
+* @brief    Saturate to 16-bit
+*
+* @param[in]  	x			- Value
+* @return       y			- Value saturated to int16_t range
+*/
+////////////////////////////////////////////////////////////////////////////////
+static inline int16_t rate_limiter_sat16(const int32_t x)
+{
+	int32_t y = x;
+
+	if ( y > INT16_MAX )
+	{
+		y = INT16_MAX;
+	}
+	else if ( y < INT16_MIN )
+	{
+		y = INT16_MIN;
+	}
+	else
+	{
+		// In range...
+	}
+
+	return (int16_t) y;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/*!
+* @brief    Slew limit Q15 input signal against previous output, clamp form
+*
+* @note Computed as y = x_prev +sat clamp( x -sat x_prev, -k_fall, k_rise ),
+* 		using only saturating add/sub and min/max, which map directly to
+* 		packed SIMD instructions. As slew rate factors are in [0, 32767],
+* 		result is bit exact to compare form of Q15 rate limiter.
+*
+* @param[in]  	x			- Input signal
+* @param[in]  	x_prev		- Previous output signal
+* @param[in]  	k_rise		- Rising slew rate factor
+* @param[in]  	k_fall		- Falling slew rate factor
+* @return       y			- Output (slew limited) signal
+*/
+////////////////////////////////////////////////////////////////////////////////
+static inline int16_t rate_limiter_q15_limit_sat(const int16_t x, const int16_t x_prev, const int16_t k_rise, const int16_t k_fall)
+{
+	int16_t dx = rate_limiter_sat16( (int32_t) x - (int32_t) x_prev );
+
+	if ( dx > k_rise )
+	{
+		dx = k_rise;
+	}
+
+	if ( dx < -k_fall )
+	{
+		dx = (int16_t) -k_fall;
+	}
+
+	return rate_limiter_sat16( (int32_t) x_prev + (int32_t) dx );
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/*!
+* @brief    Convert IEEE half precision (fp16) value to float
+*
+* @param[in]  	h			- Raw half precision value
+* @return       y			- Float value
+*/
+////////////////////////////////////////////////////////////////////////////////
+static inline float32_t rate_limiter_fp16_to_f32(const uint16_t h)
+{
+	const uint32_t 		sign 	= ((uint32_t)( h & 0x8000U ) << 16U );
+	const uint32_t 		exp 	= (( h >> 10U ) & 0x1FU );
+	const uint32_t 		mant 	= ( h & 0x3FFU );
+	rate_limiter_bits_t y;
+
+	// Inf or NaN, NaN is quieted same as with F16C
+	if ( 0x1FU == exp )
+	{
+		y.u = ( sign | 0x7F800000UL | ( mant << 13U ));
+
+		if ( 0U != mant )
+		{
+			y.u |= 0x00400000UL;
+		}
+	}
+
+	// Zero or subnormal, exact as mant * 2^-24
+	else if ( 0U == exp )
+	{
+		y.f = ((float32_t) mant * 5.9604644775390625e-8f );
+		y.u |= sign;
+	}
+
+	// Normal
+	else
+	{
+		y.u = ( sign | (( exp + 112U ) << 23U ) | ( mant << 13U ));
+	}
+
+	return y.f;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/*!
+* @brief    Convert float to IEEE half precision (fp16) value
+*
+* @note Rounding is to nearest even, same as F16C conversion with
+* 		_MM_FROUND_TO_NEAREST_INT. Values out of range become infinity and
+* 		NaN stays (quiet) NaN.
+*
+* @param[in]  	x			- Float value
+* @return       h			- Raw half precision value
+*/
+////////////////////////////////////////////////////////////////////////////////
+static inline uint16_t rate_limiter_f32_to_fp16(const float32_t x)
+{
+	rate_limiter_bits_t x_bits;
+	rate_limiter_bits_t sub;
+	uint32_t			sign	= 0;
+	uint32_t			abs		= 0;
+	uint32_t			h		= 0;
+
+	x_bits.f = x;
+	sign = (( x_bits.u >> 16U ) & 0x8000U );
+	abs = ( x_bits.u & 0x7FFFFFFFUL );
+
+	// Inf or NaN
+	if ( abs >= 0x7F800000UL )
+	{
+		h = ( abs > 0x7F800000UL ) ? ( 0x7E00U | (( abs >> 13U ) & 0x3FFU )) : 0x7C00U;
+	}
+
+	// Rounds above largest half value
+	else if ( abs >= 0x477FF000UL )
+	{
+		h = 0x7C00U;
+	}
+
+	// Subnormal, rounded by float addition of 0.5 (ulp of 0.5 is 2^-24)
+	else if ( abs < 0x38800000UL )
+	{
+		x_bits.u = abs;
+		sub.f = ( x_bits.f + 0.5f );
+		h = ( sub.u - 0x3F000000UL );
+	}
+
+	// Normal, re-bias exponent and round to nearest even
+	else
+	{
+		h = (( abs + 0xC8000FFFUL + (( abs >> 13U ) & 1U )) >> 13U );
+	}
+
+	return (uint16_t)( sign | h );
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/*!
+* @brief    Convert bfloat16 value to float
+*
+* @param[in]  	h			- Raw bfloat16 value
+* @return       y			- Float value
+*/
+////////////////////////////////////////////////////////////////////////////////
+static inline float32_t rate_limiter_bf16_to_f32(const uint16_t h)
+{
+	rate_limiter_bits_t y;
+
+	y.u = ((uint32_t) h << 16U );
+
+	return y.f;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/*!
+* @brief    Convert float to bfloat16 value
+*
+* @note Rounding is to nearest even and NaN stays (quiet) NaN.
+*
+* @param[in]  	x			- Float value
+* @return       h			- Raw bfloat16 value
+*/
+////////////////////////////////////////////////////////////////////////////////
+static inline uint16_t rate_limiter_f32_to_bf16(const float32_t x)
+{
+	rate_limiter_bits_t x_bits;
+	uint32_t			h = 0;
+
+	x_bits.f = x;
+
+	// NaN
+	if (( x_bits.u & 0x7FFFFFFFUL ) > 0x7F800000UL )
+	{
+		h = (( x_bits.u >> 16U ) | 0x0040U );
+	}
+	else
+	{
+		h = (( x_bits.u + 0x7FFFUL + (( x_bits.u >> 16U ) & 1U )) >> 16U );
+	}
+
+	return (uint16_t) h;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/*!
+* @brief    Step 16-bit float value by one ulp
+*
+* @note Valid for fp16 and bf16, both are sign-magnitude. Zero of either
+* 		sign steps to smallest subnormal in direction of step.
+*
+* @param[in]  	h			- Raw 16-bit float value
+* @param[in]  	is_up		- Step towards +inf, otherwise towards -inf
+* @return       h			- Raw 16-bit float value one ulp away
+*/
+////////////////////////////////////////////////////////////////////////////////
+static inline uint16_t rate_limiter_h16_step(const uint16_t h, const bool is_up)
+{
+	uint16_t h_dir = h;
+
+	// Zero takes sign of step direction
+	if ( 0U == ( h & 0x7FFFU ))
+	{
+		h_dir = (( true == is_up ) ? 0x0000U : 0x8000U );
+	}
+
+	// Magnitude grows when step direction matches sign
+	return (uint16_t)(( is_up == ( 0U == ( h_dir & 0x8000U ))) ? ( h_dir + 1U ) : ( h_dir - 1U ));
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/*!
+* @brief    Position of 16-bit float state with sub-ulp remainder
+*
+* @note Product of remainder and its resolution is exact, so result does
+* 		not depend on contraction into FMA.
+*
+* @param[in]  	h_f			- Stored value widened to float
+* @param[in]  	res			- Sub-ulp remainder
+* @param[in]  	lsb			- Remainder resolution at stored value
+* @return       x			- Position of channel
+*/
+////////////////////////////////////////////////////////////////////////////////
+static inline float32_t rate_limiter_h16_pos(const float32_t h_f, const int16_t res, const float32_t lsb)
+{
+	return (( 0 == res ) ? h_f : ( h_f + ((float32_t) res * lsb )));
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/*!
+* @brief    Sub-ulp remainder of 16-bit float state
+*
+* @note Remainder is truncated towards stored value, thus position never
+* 		gets ahead of limited value. Out of range or NaN remainder is
+* 		dropped.
+*
+* @param[in]  	y			- Limited value
+* @param[in]  	h_f			- Stored value widened to float
+* @param[in]  	lsb			- Remainder resolution at stored value
+* @return       res			- Sub-ulp remainder
+*/
+////////////////////////////////////////////////////////////////////////////////
+static inline int16_t rate_limiter_h16_res(const float32_t y, const float32_t h_f, const float32_t lsb)
+{
+	const float32_t res = (( y - h_f ) / lsb );
+
+	return ((( res > -( RATE_LIMITER_H16_RES_MAX )) && ( res < RATE_LIMITER_H16_RES_MAX )) ? (int16_t) res : 0 );
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/*!
+* @brief    Remainder resolution of fp16 value
+*
+* @param[in]  	h			- Raw fp16 value
+* @return       lsb			- Ulp away from zero times RATE_LIMITER_H16_RES_LSB
+*/
+////////////////////////////////////////////////////////////////////////////////
+static inline float32_t rate_limiter_fp16_res_lsb(const uint16_t h)
+{
+	const uint16_t h_abs = (uint16_t)( h & 0x7FFFU );
+
+	return (( rate_limiter_fp16_to_f32( (uint16_t)( h_abs + 1U )) - rate_limiter_fp16_to_f32( h_abs )) * RATE_LIMITER_H16_RES_LSB );
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/*!
+* @brief    Remainder resolution of bf16 value
+*
+* @param[in]  	h			- Raw bf16 value
+* @return       lsb			- Ulp away from zero times RATE_LIMITER_H16_RES_LSB
+*/
+////////////////////////////////////////////////////////////////////////////////
+static inline float32_t rate_limiter_bf16_res_lsb(const uint16_t h)
+{
+	const uint16_t h_abs = (uint16_t)( h & 0x7FFFU );
+
+	return (( rate_limiter_bf16_to_f32( (uint16_t)( h_abs + 1U )) - rate_limiter_bf16_to_f32( h_abs )) * RATE_LIMITER_H16_RES_LSB );
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/*!
+* @brief    Slew limit input signal against fp16 stored state
+*
+* @note Computation is done in float, result is rounded to storage format
+* 		and output is stored value widened back to float, so that output
+* 		always equals state of channel.
+*
+* 		Part of change below storage resolution is kept as sub-ulp
+* 		remainder, thus channel moves with requested slew rate on average
+* 		even if factor is smaller than one ulp. While moving, stored value
+* 		is rounded towards previous position, so that it never gets ahead
+* 		of limited value. Settled channel stores input rounded to nearest.
+*
+* @param[in]  	x			- Input signal
+* @param[in,out]	p_x_prev	- Pointer to stored previous output
+* @param[in,out]	p_x_res		- Pointer to sub-ulp remainder
+* @param[in]  	k_rise		- Stored rising slew rate factor
+* @param[in]  	k_fall		- Stored falling slew rate factor
+* @return       y			- Output (slew limited) signal
+*/
+////////////////////////////////////////////////////////////////////////////////
+static inline float32_t rate_limiter_fp16_limit(const float32_t x, uint16_t * const p_x_prev, int16_t * const p_x_res, const uint16_t k_rise, const uint16_t k_fall)
+{
+	const float32_t x_prev 	= rate_limiter_h16_pos( rate_limiter_fp16_to_f32( *p_x_prev ), *p_x_res, rate_limiter_fp16_res_lsb( *p_x_prev ));
+	const float32_t y 		= rate_limiter_limit_sel( x, x_prev, rate_limiter_fp16_to_f32( k_rise ), rate_limiter_fp16_to_f32( k_fall ));
+	uint16_t		h		= rate_limiter_f32_to_fp16( y );
+	float32_t		h_f		= rate_limiter_fp16_to_f32( h );
+
+	// Moving and rounded ahead of limited value, step back
+	if 	(	(( y > x ) || ( y < x ))
+		&&	((( y > x_prev ) && ( h_f > y )) || (( y < x_prev ) && ( h_f < y ))))
+	{
+		h 	= rate_limiter_h16_step( h, ( y < x_prev ));
+		h_f = rate_limiter_fp16_to_f32( h );
+	}
+
+	*p_x_prev 	= h;
+	*p_x_res	= rate_limiter_h16_res( y, h_f, rate_limiter_fp16_res_lsb( h ));
+
+	return h_f;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/*!
+* @brief    Slew limit input signal against bf16 stored state
+*
+* @note Same as "rate_limiter_fp16_limit()" with bfloat16 storage,
+* 		including sub-ulp remainder.
+*
+* @param[in]  	x			- Input signal
+* @param[in,out]	p_x_prev	- Pointer to stored previous output
+* @param[in,out]	p_x_res		- Pointer to sub-ulp remainder
+* @param[in]  	k_rise		- Stored rising slew rate factor
+* @param[in]  	k_fall		- Stored falling slew rate factor
+* @return       y			- Output (slew limited) signal
+*/
+////////////////////////////////////////////////////////////////////////////////
+static inline float32_t rate_limiter_bf16_limit(const float32_t x, uint16_t * const p_x_prev, int16_t * const p_x_res, const uint16_t k_rise, const uint16_t k_fall)
+{
+	const float32_t x_prev 	= rate_limiter_h16_pos( rate_limiter_bf16_to_f32( *p_x_prev ), *p_x_res, rate_limiter_bf16_res_lsb( *p_x_prev ));
+	const float32_t y 		= rate_limiter_limit_sel( x, x_prev, rate_limiter_bf16_to_f32( k_rise ), rate_limiter_bf16_to_f32( k_fall ));
+	uint16_t		h		= rate_limiter_f32_to_bf16( y );
+	float32_t		h_f		= rate_limiter_bf16_to_f32( h );
+
+	// Moving and rounded ahead of limited value, step back
+	if 	(	(( y > x ) || ( y < x ))
+		&&	((( y > x_prev ) && ( h_f > y )) || (( y < x_prev ) && ( h_f < y ))))
+	{
+		h 	= rate_limiter_h16_step( h, ( y < x_prev ));
+		h_f = rate_limiter_bf16_to_f32( h );
+	}
+
+	*p_x_prev 	= h;
+	*p_x_res	= rate_limiter_h16_res( y, h_f, rate_limiter_bf16_res_lsb( h ));
+
+	return h_f;
+}
+
+#endif // __RATE_LIMITER_KERNEL_H
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+* @} <!-- END GROUP -->
+*/
+////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,1044 @@
+// Copyright (c) 2021 Ziga Miklosic
+// All Rights Reserved
+// This software is under MIT licence (https://opensource.org/licenses/MIT)
+////////////////////////////////////////////////////////////////////////////////
+/**
+*@file      rate_limiter_parallel.c
+*@brief     Multi-threaded rate limiter bank update
+*@author    Ziga Miklosic
+*@date      19.02.2021
+*@version   V1.1.0
+*
+*@section Description
+*
+*	Persistent pool of POSIX worker threads for updating large rate
+*	limiter banks within single tick. Threads are created once at pool
+*	initialization, optionally pinned to given cores, and sleep between
+*	ticks. Nothing is allocated and no thread is created per tick.
+*
+*	Each tick bank is split into one partition per thread with
+*	"rate_limiter_bank_get_partition()". Partitions start on aligned
+*	block of bank state, so threads never share cache line of state.
+*	Calling thread processes first partition itself and returns after
+*	all partitions are done (barrier at end of tick).
+*
+*	For mixed workloads (several banks, target mode banks with uneven
+*	number of active channels) "rate_limiter_parallel_run_jobs()" splits
+*	all jobs into tasks of RATE_LIMITER_PARALLEL_GRAIN channels. Each
+*	thread owns Chase-Lev deque, seeded with contiguous block of tasks.
+*	Owner takes tasks from bottom of its deque, idle threads steal from
+*	top of other deques, so tail of tick is shared instead of waiting on
+*	slowest partition. Load balance statistics of last tick are kept per
+*	thread. Deques are fixed size (RATE_LIMITER_PARALLEL_DEQUE_SIZE), when
+*	tasks would not fit grain is doubled for that tick.
+*
+*	Pool is controlled from single thread only. Work stealing requires C11
+*	atomics.
+*
+*	Enabled with RATE_LIMITER_PARALLEL_EN.
+*
+*@section Code_example
+*@code
+*
+*	// Four threads: calling thread plus three workers on cores 1..3
+*	static const int32_t cores[] = { 1, 2, 3 };
+*	static p_rate_limiter_parallel_t my_pool = NULL;
+*
+*	if ( eRATE_LIMITER_OK != rate_limiter_parallel_init( &my_pool, 4U, cores ))
+*	{
+*		// Init failed...
+*	}
+*
+*	@period_time
+*	{
+*		rate_limiter_bank_update_parallel( my_pool, my_bank, raw_signals, slew_rated_signals );
+*	}
+*
+*	// Or, several banks with work stealing
+*	static const rate_limiter_parallel_job_t jobs[] =
+*	{
+*		{ .bank = my_bank, .p_x = raw_signals, .p_y = slew_rated_signals, .type = eRATE_LIMITER_PARALLEL_JOB_UPDATE },
+*		{ .bank = my_target_bank, .type = eRATE_LIMITER_PARALLEL_JOB_UPDATE_ACTIVE },
+*	};
+*
+*	@period_time
+*	{
+*		rate_limiter_parallel_run_jobs( my_pool, jobs, 2U );
+*	}
+*
+*@endcode
+*
+*/
+////////////////////////////////////////////////////////////////////////////////
+/*!
+* @addtogroup RATE_LIMITER_PARALLEL
+* @{ <!-- BEGIN GROUP -->
+*/
+////////////////////////////////////////////////////////////////////////////////
+
+#if defined( __linux__ ) && !defined( _GNU_SOURCE )
+	#define _GNU_SOURCE
+#endif
+
+////////////////////////////////////////////////////////////////////////////////
+// Includes
+////////////////////////////////////////////////////////////////////////////////
+#include "rate_limiter_parallel.h"
+
+#if ( 1 == RATE_LIMITER_PARALLEL_EN )
+
+#include <pthread.h>
+#include <sched.h>
+#include <stdatomic.h>
+#include <string.h>
+#include <time.h>
+
+////////////////////////////////////////////////////////////////////////////////
+// Definitions
+////////////////////////////////////////////////////////////////////////////////
+
+/**
+ * 	Barrier
+ *
+ * @note Built on mutex and condition variable instead of pthread_barrier_t,
+ * 		which is optional in POSIX and has fixed number of participants.
+ */
+typedef struct
+{
+	pthread_mutex_t	mutex;		/**<Barrier lock */
+	pthread_cond_t	cond;		/**<Barrier release condition */
+	uint32_t		count;		/**<Number of participants */
+	uint32_t		waiting;	/**<Number of waiting participants */
+	uint32_t		generation;	/**<Barrier generation, incremented on release */
+} rate_limiter_parallel_barrier_t;
+
+/**
+ * 	Cache line size
+ */
+#define RATE_LIMITER_PARALLEL_LINE			( RATE_LIMITER_BANK_ALIGN )
+
+/**
+ * 	Deque index mask
+ */
+#define RATE_LIMITER_PARALLEL_DEQUE_MASK	( RATE_LIMITER_PARALLEL_DEQUE_SIZE - 1U )
+
+/**
+ * 	Compile time check of work stealing configuration
+ */
+typedef char rate_limiter_parallel_deque_size_check_t[( 0U == ( RATE_LIMITER_PARALLEL_DEQUE_SIZE & RATE_LIMITER_PARALLEL_DEQUE_MASK )) ? 1 : -1];
+typedef char rate_limiter_parallel_grain_check_t[(( 0U == ( RATE_LIMITER_PARALLEL_GRAIN % 32U )) && ( 0U == ( RATE_LIMITER_PARALLEL_GRAIN % ( RATE_LIMITER_BANK_ALIGN / sizeof( float32_t ))))) ? 1 : -1];
+
+/**
+ * 	Tick mode
+ */
+typedef enum
+{
+	eRATE_LIMITER_PARALLEL_MODE_PARTITION = 0,	/**<Static partition of single bank */
+	eRATE_LIMITER_PARALLEL_MODE_STEAL,			/**<Work stealing over jobs */
+} rate_limiter_parallel_mode_t;
+
+/**
+ * 	Thread of pool
+ *
+ * @note Entry 0 is calling thread. Deque ends are on own cache lines, as
+ * 		bottom is written by owner and top by thieves.
+ */
+typedef struct
+{
+	_Atomic int32_t							bottom;										/**<Deque bottom, owner end */
+	uint8_t									pad_bottom[ RATE_LIMITER_PARALLEL_LINE - sizeof( int32_t )];
+	_Atomic int32_t							top;										/**<Deque top, steal end */
+	uint8_t									pad_top[ RATE_LIMITER_PARALLEL_LINE - sizeof( int32_t )];
+	_Atomic uint32_t						task[ RATE_LIMITER_PARALLEL_DEQUE_SIZE ];	/**<Deque of tasks */
+	rate_limiter_parallel_thread_stats_t	stats;										/**<Statistics of last tick */
+	struct rate_limiter_parallel_s *		p_pool;										/**<Parent pool */
+	pthread_t								thread;										/**<Thread handle */
+	uint32_t								part;										/**<Thread index, bank partition of thread */
+} RATE_LIMITER_ALIGNED( RATE_LIMITER_PARALLEL_LINE ) rate_limiter_parallel_worker_t;
+
+/**
+ * 	Worker pool
+ */
+typedef struct rate_limiter_parallel_s
+{
+	rate_limiter_parallel_worker_t *	p_worker;		/**<Threads, calling thread first */
+	void *								p_mem;			/**<Unaligned thread allocation */
+	rate_limiter_parallel_barrier_t		barrier;		/**<Tick start/end barrier */
+	rate_limiter_parallel_mode_t		mode;			/**<Mode of current tick */
+	p_rate_limiter_bank_t				bank;			/**<Bank of current tick */
+	const float32_t *					p_x;			/**<Inputs of current tick */
+	float32_t *							p_y;			/**<Outputs of current tick */
+	const rate_limiter_parallel_job_t *	p_jobs;			/**<Jobs of current tick */
+	uint32_t							num_of_jobs;	/**<Number of jobs of current tick */
+	uint32_t							first_task[ RATE_LIMITER_PARALLEL_MAX_JOBS + 1U ];	/**<First task of each job */
+	uint32_t							grain;			/**<Task size of current tick */
+	_Atomic uint32_t					num_of_remain;	/**<Number of not yet finished tasks */
+	rate_limiter_parallel_stats_t		stats;			/**<Statistics of last work stealing tick */
+	uint32_t							num_of_workers;	/**<Number of worker threads */
+	bool								stop;			/**<Worker exit request */
+	bool								is_init;		/**<Pool initialization success flag */
+} rate_limiter_parallel_t;
+
+////////////////////////////////////////////////////////////////////////////////
+// Variables
+////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////
+// Function prototypes
+////////////////////////////////////////////////////////////////////////////////
+static void		rate_limiter_parallel_barrier_wait	(rate_limiter_parallel_barrier_t * const p_barrier);
+static uint64_t	rate_limiter_parallel_now			(void);
+static void		rate_limiter_parallel_run			(p_rate_limiter_parallel_t pool, const uint32_t part);
+static void		rate_limiter_parallel_push			(rate_limiter_parallel_worker_t * const p_worker, const uint32_t task);
+static bool		rate_limiter_parallel_take			(rate_limiter_parallel_worker_t * const p_worker, uint32_t * const p_task);
+static bool		rate_limiter_parallel_steal			(rate_limiter_parallel_worker_t * const p_victim, uint32_t * const p_task);
+static void		rate_limiter_parallel_exec			(p_rate_limiter_parallel_t pool, rate_limiter_parallel_worker_t * const p_worker, const uint32_t task);
+static void		rate_limiter_parallel_run_steal		(p_rate_limiter_parallel_t pool, rate_limiter_parallel_worker_t * const p_worker);
+static void *	rate_limiter_parallel_worker		(void * p_arg);
+static bool		rate_limiter_parallel_start			(p_rate_limiter_parallel_t pool, const int32_t * const p_cores);
+static void		rate_limiter_parallel_stop			(p_rate_limiter_parallel_t pool, const uint32_t num_of_started);
+
+////////////////////////////////////////////////////////////////////////////////
+// Functions
+////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////
+/*!
+* @brief    Wait on barrier until all participants arrive
+*
+* @param[in]  	p_barrier	- Pointer to barrier
+* @return       void
+*/
+////////////////////////////////////////////////////////////////////////////////
+static void rate_limiter_parallel_barrier_wait(rate_limiter_parallel_barrier_t * const p_barrier)
+{
+	uint32_t generation = 0;
+
+	(void) pthread_mutex_lock( &p_barrier->mutex );
+
+	generation = p_barrier->generation;
+	p_barrier->waiting++;
+
+	// Last participant releases all others
+	if ( p_barrier->waiting >= p_barrier->count )
+	{
+		p_barrier->waiting = 0U;
+		p_barrier->generation++;
+
+		(void) pthread_cond_broadcast( &p_barrier->cond );
+	}
+	else
+	{
+		while ( generation == p_barrier->generation )
+		{
+			(void) pthread_cond_wait( &p_barrier->cond, &p_barrier->mutex );
+		}
+	}
+
+	(void) pthread_mutex_unlock( &p_barrier->mutex );
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/*!
+* @brief    Update single bank partition of current tick
+*
+* @param[in]  	pool		- Pointer to worker pool
+* @param[in]  	part		- Partition index
+* @return       void
+*/
+////////////////////////////////////////////////////////////////////////////////
+static void rate_limiter_parallel_run(p_rate_limiter_parallel_t pool, const uint32_t part)
+{
+	uint32_t first_ch 	= 0;
+	uint32_t num_of_ch	= 0;
+
+	if ( eRATE_LIMITER_OK == rate_limiter_bank_get_partition( pool->bank, part, ( pool->num_of_workers + 1U ), &first_ch, &num_of_ch ))
+	{
+		if ( num_of_ch > 0U )
+		{
+			(void) rate_limiter_bank_update_range( pool->bank, pool->p_x, pool->p_y, first_ch, num_of_ch );
+		}
+	}
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/*!
+* @brief    Get monotonic time
+*
+* @return       time		- Monotonic time in ns
+*/
+////////////////////////////////////////////////////////////////////////////////
+static uint64_t rate_limiter_parallel_now(void)
+{
+	struct timespec ts;
+
+	(void) clock_gettime( CLOCK_MONOTONIC, &ts );
+
+	return (( (uint64_t) ts.tv_sec * 1000000000ULL ) + (uint64_t) ts.tv_nsec );
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/*!
+* @brief    Push task to bottom of own deque
+*
+* @note Only owner pushes. Capacity is guaranteed by grain selection.
+*
+* @param[in]  	p_worker	- Pointer to owner thread
+* @param[in]  	task		- Task index
+* @return       void
+*/
+////////////////////////////////////////////////////////////////////////////////
+static void rate_limiter_parallel_push(rate_limiter_parallel_worker_t * const p_worker, const uint32_t task)
+{
+	const int32_t b = atomic_load_explicit( &p_worker->bottom, memory_order_relaxed );
+
+	atomic_store_explicit( &p_worker->task[ (uint32_t) b & RATE_LIMITER_PARALLEL_DEQUE_MASK ], task, memory_order_relaxed );
+	atomic_thread_fence( memory_order_release );
+	atomic_store_explicit( &p_worker->bottom, ( b + 1 ), memory_order_relaxed );
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/*!
+* @brief    Take task from bottom of own deque
+*
+* @note Chase-Lev take, owner races with thieves only for last task.
+*
+* @param[in]  	p_worker	- Pointer to owner thread
+* @param[out]  	p_task		- Task index
+* @return       success		- True when task is taken
+*/
+////////////////////////////////////////////////////////////////////////////////
+static bool rate_limiter_parallel_take(rate_limiter_parallel_worker_t * const p_worker, uint32_t * const p_task)
+{
+	const int32_t	b		= ( atomic_load_explicit( &p_worker->bottom, memory_order_relaxed ) - 1 );
+	int32_t			t		= 0;
+	bool			success	= false;
+
+	atomic_store_explicit( &p_worker->bottom, b, memory_order_relaxed );
+	atomic_thread_fence( memory_order_seq_cst );
+	t = atomic_load_explicit( &p_worker->top, memory_order_relaxed );
+
+	if ( t <= b )
+	{
+		*p_task = atomic_load_explicit( &p_worker->task[ (uint32_t) b & RATE_LIMITER_PARALLEL_DEQUE_MASK ], memory_order_relaxed );
+		success = true;
+
+		// Last task, race against thieves
+		if ( t == b )
+		{
+			success = atomic_compare_exchange_strong_explicit( &p_worker->top, &t, ( t + 1 ), memory_order_seq_cst, memory_order_relaxed );
+
+			atomic_store_explicit( &p_worker->bottom, ( b + 1 ), memory_order_relaxed );
+		}
+	}
+	else
+	{
+		// Empty
+		atomic_store_explicit( &p_worker->bottom, ( b + 1 ), memory_order_relaxed );
+	}
+
+	return success;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/*!
+* @brief    Steal task from top of other thread deque
+*
+* @param[in]  	p_victim	- Pointer to owner of deque
+* @param[out]  	p_task		- Task index
+* @return       success		- True when task is stolen
+*/
+////////////////////////////////////////////////////////////////////////////////
+static bool rate_limiter_parallel_steal(rate_limiter_parallel_worker_t * const p_victim, uint32_t * const p_task)
+{
+	int32_t	t		= atomic_load_explicit( &p_victim->top, memory_order_acquire );
+	int32_t	b		= 0;
+	bool	success	= false;
+
+	atomic_thread_fence( memory_order_seq_cst );
+	b = atomic_load_explicit( &p_victim->bottom, memory_order_acquire );
+
+	if ( t < b )
+	{
+		*p_task = atomic_load_explicit( &p_victim->task[ (uint32_t) t & RATE_LIMITER_PARALLEL_DEQUE_MASK ], memory_order_relaxed );
+
+		success = atomic_compare_exchange_strong_explicit( &p_victim->top, &t, ( t + 1 ), memory_order_seq_cst, memory_order_relaxed );
+	}
+
+	return success;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/*!
+* @brief    Execute single task of current tick
+*
+* @param[in]  	pool		- Pointer to worker pool
+* @param[in]  	p_worker	- Pointer to executing thread
+* @param[in]  	task		- Task index
+* @return       void
+*/
+////////////////////////////////////////////////////////////////////////////////
+static void rate_limiter_parallel_exec(p_rate_limiter_parallel_t pool, rate_limiter_parallel_worker_t * const p_worker, const uint32_t task)
+{
+	const rate_limiter_parallel_job_t *	p_job		= NULL;
+	const uint64_t						start		= rate_limiter_parallel_now();
+	uint32_t							job			= 0;
+	uint32_t							first_ch	= 0;
+	uint32_t							num_of_ch	= 0;
+
+	// Find job of task
+	while ( task >= pool->first_task[ job + 1U ] )
+	{
+		job++;
+	}
+
+	p_job = &pool->p_jobs[job];
+	first_ch = (( task - pool->first_task[job] ) * pool->grain );
+	num_of_ch = ( rate_limiter_bank_get_num_of_ch( p_job->bank ) - first_ch );
+
+	if ( num_of_ch > pool->grain )
+	{
+		num_of_ch = pool->grain;
+	}
+
+	if ( eRATE_LIMITER_PARALLEL_JOB_UPDATE_ACTIVE == p_job->type )
+	{
+		(void) rate_limiter_bank_update_active_range( p_job->bank, first_ch, num_of_ch );
+	}
+	else
+	{
+		(void) rate_limiter_bank_update_range( p_job->bank, p_job->p_x, p_job->p_y, first_ch, num_of_ch );
+	}
+
+	(void) atomic_fetch_sub_explicit( &pool->num_of_remain, 1U, memory_order_release );
+
+	p_worker->stats.busy_ns += ( rate_limiter_parallel_now() - start );
+	p_worker->stats.num_of_tasks++;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/*!
+* @brief    Work stealing tick of single thread
+*
+* @note Thread seeds own deque with contiguous block of tasks, pushed in
+* 		descending order, so owner walks channels in ascending order and
+* 		thieves take from far end of block. When own deque is empty thread
+* 		steals until all tasks of tick are finished.
+*
+* @param[in]  	pool		- Pointer to worker pool
+* @param[in]  	p_worker	- Pointer to thread
+* @return       void
+*/
+////////////////////////////////////////////////////////////////////////////////
+static void rate_limiter_parallel_run_steal(p_rate_limiter_parallel_t pool, rate_limiter_parallel_worker_t * const p_worker)
+{
+	const uint32_t	num_of_threads	= ( pool->num_of_workers + 1U );
+	const uint32_t	num_of_tasks	= pool->first_task[ pool->num_of_jobs ];
+	const uint32_t	per_thread		= (( num_of_tasks + num_of_threads - 1U ) / num_of_threads );
+	uint32_t		first			= ( p_worker->part * per_thread );
+	uint32_t		end				= ( first + per_thread );
+	uint32_t		task			= 0;
+	uint32_t		i				= 0;
+	bool			found			= false;
+
+	if ( first > num_of_tasks )
+	{
+		first = num_of_tasks;
+	}
+	if ( end > num_of_tasks )
+	{
+		end = num_of_tasks;
+	}
+
+	// Seed own deque
+	for ( task = end; task > first; task-- )
+	{
+		rate_limiter_parallel_push( p_worker, ( task - 1U ));
+	}
+
+	// Own tasks
+	while ( true == rate_limiter_parallel_take( p_worker, &task ))
+	{
+		rate_limiter_parallel_exec( pool, p_worker, task );
+	}
+
+	// Steal until tick is done
+	while ( 0U != atomic_load_explicit( &pool->num_of_remain, memory_order_acquire ))
+	{
+		found = false;
+
+		for ( i = 1U; ( i < num_of_threads ) && ( false == found ); i++ )
+		{
+			if ( true == rate_limiter_parallel_steal( &pool->p_worker[ ( p_worker->part + i ) % num_of_threads ], &task ))
+			{
+				rate_limiter_parallel_exec( pool, p_worker, task );
+				p_worker->stats.num_of_stolen++;
+				found = true;
+			}
+			else
+			{
+				p_worker->stats.num_of_steal_fail++;
+			}
+		}
+
+		// Remaining tasks are in progress on other threads
+		if ( false == found )
+		{
+			(void) sched_yield();
+		}
+	}
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/*!
+* @brief    Worker thread
+*
+* @param[in]  	p_arg		- Pointer to worker
+* @return       NULL
+*/
+////////////////////////////////////////////////////////////////////////////////
+static void * rate_limiter_parallel_worker(void * p_arg)
+{
+	rate_limiter_parallel_worker_t * const 	p_worker 	= (rate_limiter_parallel_worker_t*) p_arg;
+	p_rate_limiter_parallel_t				pool		= p_worker->p_pool;
+
+	for (;;)
+	{
+		// Wait for tick start
+		rate_limiter_parallel_barrier_wait( &pool->barrier );
+
+		if ( true == pool->stop )
+		{
+			break;
+		}
+
+		if ( eRATE_LIMITER_PARALLEL_MODE_STEAL == pool->mode )
+		{
+			rate_limiter_parallel_run_steal( pool, p_worker );
+		}
+		else
+		{
+			rate_limiter_parallel_run( pool, p_worker->part );
+		}
+
+		// Signal tick end
+		rate_limiter_parallel_barrier_wait( &pool->barrier );
+	}
+
+	return NULL;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/*!
+* @brief    Start worker threads
+*
+* @note On failure already started workers are stopped.
+*
+* @param[in]  	pool		- Pointer to worker pool
+* @param[in]  	p_cores		- Cores of workers, NULL for no pinning
+* @return       success		- True when all workers are started
+*/
+////////////////////////////////////////////////////////////////////////////////
+static bool rate_limiter_parallel_start(p_rate_limiter_parallel_t pool, const int32_t * const p_cores)
+{
+	pthread_attr_t	attr;
+	bool			success	= true;
+	uint32_t		w		= 0;
+
+	#if defined( __linux__ )
+		cpu_set_t	cpu_set;
+	#endif
+
+	// Calling thread
+	pool->p_worker[0].p_pool = pool;
+	pool->p_worker[0].part = 0U;
+
+	for ( w = 1U; ( w <= pool->num_of_workers ) && ( true == success ); w++ )
+	{
+		pool->p_worker[w].p_pool = pool;
+		pool->p_worker[w].part = w;
+
+		if ( 0 == pthread_attr_init( &attr ))
+		{
+			#if defined( __linux__ )
+				if ( NULL != p_cores )
+				{
+					CPU_ZERO( &cpu_set );
+					CPU_SET( p_cores[ w - 1U ], &cpu_set );
+
+					(void) pthread_attr_setaffinity_np( &attr, sizeof( cpu_set_t ), &cpu_set );
+				}
+			#else
+				(void) p_cores;
+			#endif
+
+			if ( 0 != pthread_create( &pool->p_worker[w].thread, &attr, &rate_limiter_parallel_worker, &pool->p_worker[w] ))
+			{
+				success = false;
+			}
+
+			(void) pthread_attr_destroy( &attr );
+		}
+		else
+		{
+			success = false;
+		}
+	}
+
+	if ( false == success )
+	{
+		rate_limiter_parallel_stop( pool, ( w - 2U ));
+	}
+
+	return success;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/*!
+* @brief    Stop and join worker threads
+*
+* @param[in]  	pool				- Pointer to worker pool
+* @param[in]  	num_of_started		- Number of running workers
+* @return       void
+*/
+////////////////////////////////////////////////////////////////////////////////
+static void rate_limiter_parallel_stop(p_rate_limiter_parallel_t pool, const uint32_t num_of_started)
+{
+	uint32_t w = 0;
+
+	// Only running workers take part in barrier
+	(void) pthread_mutex_lock( &pool->barrier.mutex );
+	pool->barrier.count = ( num_of_started + 1U );
+	(void) pthread_mutex_unlock( &pool->barrier.mutex );
+
+	// Release workers with exit request
+	pool->stop = true;
+	rate_limiter_parallel_barrier_wait( &pool->barrier );
+
+	for ( w = 1U; w <= num_of_started; w++ )
+	{
+		(void) pthread_join( pool->p_worker[w].thread, NULL );
+	}
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+* @} <!-- END GROUP -->
+*/
+////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*@addtogroup RATE_LIMITER_PARALLEL_API
+* @{ <!-- BEGIN GROUP -->
+*
+* 	Following function are part or multi-threaded rate limiter bank API.
+*/
+////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////
+/*!
+* @brief    Initialize worker pool
+*
+* @note Calling thread is one of threads, thus num_of_threads - 1 worker
+* 		threads are created. On Linux each worker can be pinned to core,
+* 		calling thread affinity is left unchanged.
+*
+* @param[out]  	p_pool			- Pointer to worker pool
+* @param[in]  	num_of_threads	- Number of threads, including calling thread
+* @param[in]  	p_cores			- Cores of workers (num_of_threads - 1 entries), NULL for no pinning
+* @return       status			- Either OK or Error
+*/
+////////////////////////////////////////////////////////////////////////////////
+rate_limiter_status_t rate_limiter_parallel_init(p_rate_limiter_parallel_t * p_pool, const uint32_t num_of_threads, const int32_t * const p_cores)
+{
+	rate_limiter_status_t status = eRATE_LIMITER_OK;
+
+	if 	(	( NULL != p_pool )
+		&&	( num_of_threads > 0U ))
+	{
+		// Allocate space
+		*p_pool = malloc( sizeof( rate_limiter_parallel_t ));
+
+		if ( NULL != *p_pool )
+		{
+			(*p_pool)->num_of_workers = ( num_of_threads - 1U );
+
+			// Threads start on cache line, calling thread included
+			(*p_pool)->p_mem = malloc(( num_of_threads * sizeof( rate_limiter_parallel_worker_t )) + RATE_LIMITER_PARALLEL_LINE );
+			(*p_pool)->p_worker = NULL;
+
+			if ( NULL != (*p_pool)->p_mem )
+			{
+				(*p_pool)->p_worker = (rate_limiter_parallel_worker_t*) ((( uintptr_t ) (*p_pool)->p_mem + RATE_LIMITER_PARALLEL_LINE - 1U ) & ~((uintptr_t) RATE_LIMITER_PARALLEL_LINE - 1U ));
+				memset( (*p_pool)->p_worker, 0, ( num_of_threads * sizeof( rate_limiter_parallel_worker_t )));
+			}
+
+			(*p_pool)->mode = eRATE_LIMITER_PARALLEL_MODE_PARTITION;
+			(*p_pool)->p_jobs = NULL;
+			(*p_pool)->num_of_jobs = 0U;
+			(*p_pool)->grain = RATE_LIMITER_PARALLEL_GRAIN;
+			atomic_init( &(*p_pool)->num_of_remain, 0U );
+			memset( &(*p_pool)->stats, 0, sizeof( rate_limiter_parallel_stats_t ));
+			(*p_pool)->bank = NULL;
+			(*p_pool)->p_x = NULL;
+			(*p_pool)->p_y = NULL;
+			(*p_pool)->stop = false;
+			(*p_pool)->is_init = false;
+
+			(*p_pool)->barrier.count = num_of_threads;
+			(*p_pool)->barrier.waiting = 0U;
+			(*p_pool)->barrier.generation = 0U;
+
+			if 	(	( NULL != (*p_pool)->p_worker )
+				&&	( 0 == pthread_mutex_init( &(*p_pool)->barrier.mutex, NULL )))
+			{
+				if ( 0 == pthread_cond_init( &(*p_pool)->barrier.cond, NULL ))
+				{
+					if ( true == rate_limiter_parallel_start( *p_pool, p_cores ))
+					{
+						// Init success
+						(*p_pool)->is_init = true;
+					}
+					else
+					{
+						(void) pthread_cond_destroy( &(*p_pool)->barrier.cond );
+						(void) pthread_mutex_destroy( &(*p_pool)->barrier.mutex );
+
+						status = eRATE_LIMITER_ERROR;
+					}
+				}
+				else
+				{
+					(void) pthread_mutex_destroy( &(*p_pool)->barrier.mutex );
+
+					status = eRATE_LIMITER_ERROR;
+				}
+			}
+			else
+			{
+				status = eRATE_LIMITER_ERROR;
+			}
+
+			if ( eRATE_LIMITER_ERROR == status )
+			{
+				free( (*p_pool)->p_mem );
+				free( *p_pool );
+				*p_pool = NULL;
+			}
+		}
+		else
+		{
+			status = eRATE_LIMITER_ERROR;
+		}
+	}
+	else
+	{
+		status = eRATE_LIMITER_ERROR;
+	}
+
+	return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/*!
+* @brief    De-initialize worker pool
+*
+* @note Worker threads are stopped and joined.
+*
+* @param[in,out]  	p_pool		- Pointer to worker pool
+* @return       	status		- Either OK or Error
+*/
+////////////////////////////////////////////////////////////////////////////////
+rate_limiter_status_t rate_limiter_parallel_deinit(p_rate_limiter_parallel_t * p_pool)
+{
+	rate_limiter_status_t status = eRATE_LIMITER_ERROR;
+
+	// Check for pool and initialization
+	if ( NULL != p_pool )
+	{
+		if ( true == rate_limiter_parallel_is_init( *p_pool ))
+		{
+			(*p_pool)->is_init = false;
+
+			rate_limiter_parallel_stop( *p_pool, (*p_pool)->num_of_workers );
+
+			(void) pthread_cond_destroy( &(*p_pool)->barrier.cond );
+			(void) pthread_mutex_destroy( &(*p_pool)->barrier.mutex );
+
+			free( (*p_pool)->p_mem );
+			free( *p_pool );
+
+			*p_pool = NULL;
+
+			status = eRATE_LIMITER_OK;
+		}
+	}
+
+	return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/*!
+* @brief    Get success initialization flag of worker pool
+*
+* @param[in]  	pool		- Pointer to worker pool
+* @return       is_init		- Success initialization flag
+*/
+////////////////////////////////////////////////////////////////////////////////
+bool rate_limiter_parallel_is_init(p_rate_limiter_parallel_t pool)
+{
+	bool is_init = false;
+
+	if ( NULL != pool )
+	{
+		is_init = pool->is_init;
+	}
+
+	return is_init;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/*!
+* @brief    Update all channels of rate limiter bank with worker pool
+*
+* @note Bit exact to "rate_limiter_bank_update()". Returns after all
+* 		channels are updated. Input and output buffer must hold at least
+* 		number of channels samples and may point to the same location.
+*
+* @param[in]  	pool		- Pointer to worker pool
+* @param[in]  	bank		- Pointer to rate limiter bank
+* @param[in]  	p_x			- Pointer to input signals, one per channel
+* @param[out]  	p_y			- Pointer to output (slew limited) signals, one per channel
+* @return       status		- Either OK or Error
+*/
+////////////////////////////////////////////////////////////////////////////////
+rate_limiter_status_t rate_limiter_bank_update_parallel(p_rate_limiter_parallel_t pool, p_rate_limiter_bank_t bank, const float32_t * const p_x, float32_t * const p_y)
+{
+	rate_limiter_status_t status = eRATE_LIMITER_ERROR;
+
+	// Check for pool, bank and buffers
+	if 	(	( true == rate_limiter_parallel_is_init( pool ))
+		&&	( true == rate_limiter_bank_is_init( bank ))
+		&&	( NULL != p_x )
+		&&	( NULL != p_y ))
+	{
+		// Published slew rates switch once per tick, before any range
+		#if ( 1 == RATE_LIMITER_BANK_STAGE_EN )
+			(void) rate_limiter_bank_apply_rates( bank );
+		#endif
+
+		// Publish job, barrier makes it visible to workers
+		pool->mode = eRATE_LIMITER_PARALLEL_MODE_PARTITION;
+		pool->bank = bank;
+		pool->p_x = p_x;
+		pool->p_y = p_y;
+
+		// Start tick
+		rate_limiter_parallel_barrier_wait( &pool->barrier );
+
+		// Calling thread takes first partition
+		rate_limiter_parallel_run( pool, 0U );
+
+		// Wait for all partitions
+		rate_limiter_parallel_barrier_wait( &pool->barrier );
+
+		status = eRATE_LIMITER_OK;
+	}
+
+	return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/*!
+* @brief    Run bank jobs with work stealing
+*
+* @note Each job is bit exact to its serial counterpart. Jobs shall use
+* 		different banks. Full update job needs input and output buffer of
+* 		at least number of channels samples, target mode job ignores them.
+* 		Returns after all jobs are done.
+*
+* @param[in]  	pool		- Pointer to worker pool
+* @param[in]  	p_jobs		- Pointer to jobs
+* @param[in]  	num_of_jobs	- Number of jobs, up to RATE_LIMITER_PARALLEL_MAX_JOBS
+* @return       status		- Either OK or Error
+*/
+////////////////////////////////////////////////////////////////////////////////
+rate_limiter_status_t rate_limiter_parallel_run_jobs(p_rate_limiter_parallel_t pool, const rate_limiter_parallel_job_t * const p_jobs, const uint32_t num_of_jobs)
+{
+	rate_limiter_status_t 	status 			= eRATE_LIMITER_ERROR;
+	uint32_t				num_of_threads	= 0;
+	uint32_t				num_of_tasks	= 0;
+	uint32_t				num_of_ch		= 0;
+	uint32_t				grain			= RATE_LIMITER_PARALLEL_GRAIN;
+	uint64_t				start			= 0;
+	uint32_t				job				= 0;
+	uint32_t				t				= 0;
+	bool					valid			= true;
+	bool					fits			= false;
+
+	// Check for pool and jobs
+	if 	(	( true == rate_limiter_parallel_is_init( pool ))
+		&&	( NULL != p_jobs )
+		&&	( num_of_jobs > 0U )
+		&&	( num_of_jobs <= RATE_LIMITER_PARALLEL_MAX_JOBS ))
+	{
+		for ( job = 0; job < num_of_jobs; job++ )
+		{
+			if 	(	( false == rate_limiter_bank_is_init( p_jobs[job].bank ))
+				||	(	( eRATE_LIMITER_PARALLEL_JOB_UPDATE == p_jobs[job].type )
+					&&	(	( NULL == p_jobs[job].p_x )
+						||	( NULL == p_jobs[job].p_y ))))
+			{
+				valid = false;
+			}
+		}
+
+		if ( true == valid )
+		{
+			num_of_threads = ( pool->num_of_workers + 1U );
+
+			// Coarsen grain until each thread block fits into its deque
+			do
+			{
+				num_of_tasks = 0U;
+				pool->first_task[0] = 0U;
+
+				for ( job = 0; job < num_of_jobs; job++ )
+				{
+					num_of_ch = rate_limiter_bank_get_num_of_ch( p_jobs[job].bank );
+					num_of_tasks += ( num_of_ch / grain ) + (( 0U != ( num_of_ch % grain )) ? 1U : 0U );
+					pool->first_task[ job + 1U ] = num_of_tasks;
+				}
+
+				fits = ((( num_of_tasks + num_of_threads - 1U ) / num_of_threads ) <= RATE_LIMITER_PARALLEL_DEQUE_SIZE );
+
+				if ( false == fits )
+				{
+					grain *= 2U;
+				}
+			} while ( false == fits );
+
+			// Published slew rates switch once per tick, before any task
+			#if ( 1 == RATE_LIMITER_BANK_STAGE_EN )
+				for ( job = 0; job < num_of_jobs; job++ )
+				{
+					(void) rate_limiter_bank_apply_rates( p_jobs[job].bank );
+				}
+			#endif
+
+			// Publish tick, barrier makes it visible to workers
+			pool->mode = eRATE_LIMITER_PARALLEL_MODE_STEAL;
+			pool->p_jobs = p_jobs;
+			pool->num_of_jobs = num_of_jobs;
+			pool->grain = grain;
+			atomic_store_explicit( &pool->num_of_remain, num_of_tasks, memory_order_relaxed );
+
+			for ( t = 0; t < num_of_threads; t++ )
+			{
+				atomic_store_explicit( &pool->p_worker[t].top, 0, memory_order_relaxed );
+				atomic_store_explicit( &pool->p_worker[t].bottom, 0, memory_order_relaxed );
+				memset( &pool->p_worker[t].stats, 0, sizeof( rate_limiter_parallel_thread_stats_t ));
+			}
+
+			start = rate_limiter_parallel_now();
+
+			// Start tick
+			rate_limiter_parallel_barrier_wait( &pool->barrier );
+
+			rate_limiter_parallel_run_steal( pool, &pool->p_worker[0] );
+
+			// Wait for all threads
+			rate_limiter_parallel_barrier_wait( &pool->barrier );
+
+			// Tick statistics
+			pool->stats.tick_ns = ( rate_limiter_parallel_now() - start );
+			pool->stats.max_busy_ns = 0U;
+			pool->stats.min_busy_ns = UINT64_MAX;
+			pool->stats.grain = grain;
+			pool->stats.num_of_tasks = num_of_tasks;
+			pool->stats.num_of_stolen = 0U;
+
+			for ( t = 0; t < num_of_threads; t++ )
+			{
+				if ( pool->p_worker[t].stats.busy_ns > pool->stats.max_busy_ns )
+				{
+					pool->stats.max_busy_ns = pool->p_worker[t].stats.busy_ns;
+				}
+				if ( pool->p_worker[t].stats.busy_ns < pool->stats.min_busy_ns )
+				{
+					pool->stats.min_busy_ns = pool->p_worker[t].stats.busy_ns;
+				}
+
+				pool->stats.num_of_stolen += pool->p_worker[t].stats.num_of_stolen;
+			}
+
+			status = eRATE_LIMITER_OK;
+		}
+	}
+
+	return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/*!
+* @brief    Get load balance statistics of last work stealing tick
+*
+* @note Tick time histogram (e.g. p99) is left to application, sampling
+* 		tick_ns after each "rate_limiter_parallel_run_jobs()".
+*
+* @param[in]  	pool		- Pointer to worker pool
+* @param[out]  	p_stats		- Pointer to statistics
+* @return       status		- Either OK or Error
+*/
+////////////////////////////////////////////////////////////////////////////////
+rate_limiter_status_t rate_limiter_parallel_get_stats(p_rate_limiter_parallel_t pool, rate_limiter_parallel_stats_t * const p_stats)
+{
+	rate_limiter_status_t status = eRATE_LIMITER_ERROR;
+
+	if 	(	( true == rate_limiter_parallel_is_init( pool ))
+		&&	( NULL != p_stats ))
+	{
+		*p_stats = pool->stats;
+
+		status = eRATE_LIMITER_OK;
+	}
+
+	return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/*!
+* @brief    Get statistics of single thread of last work stealing tick
+*
+* @param[in]  	pool		- Pointer to worker pool
+* @param[in]  	thread		- Thread index, 0 is calling thread
+* @param[out]  	p_stats		- Pointer to statistics
+* @return       status		- Either OK or Error
+*/
+////////////////////////////////////////////////////////////////////////////////
+rate_limiter_status_t rate_limiter_parallel_get_thread_stats(p_rate_limiter_parallel_t pool, const uint32_t thread, rate_limiter_parallel_thread_stats_t * const p_stats)
+{
+	rate_limiter_status_t status = eRATE_LIMITER_ERROR;
+
+	if 	(	( true == rate_limiter_parallel_is_init( pool ))
+		&&	( NULL != p_stats ))
+	{
+		if ( thread <= pool->num_of_workers )
+		{
+			*p_stats = pool->p_worker[thread].stats;
+
+			status = eRATE_LIMITER_OK;
+		}
+	}
+
+	return status;
+}
+
+#endif // ( 1 == RATE_LIMITER_PARALLEL_EN )
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+* @} <!-- END GROUP -->
+*/
+////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,141 @@
+// Copyright (c) 2021 Ziga Miklosic
+// All Rights Reserved
+// This software is under MIT licence (https://opensource.org/licenses/MIT)
+////////////////////////////////////////////////////////////////////////////////
+/**
+*@file      rate_limiter_parallel.h
+*@brief     Multi-threaded rate limiter bank update
+*@author    Ziga Miklosic
+*@date      19.02.2021
+*@version   V1.1.0
+*/
+////////////////////////////////////////////////////////////////////////////////
+/**
+*@addtogroup RATE_LIMITER_PARALLEL_API
+* @{ <!-- BEGIN GROUP -->
+*
+*/
+////////////////////////////////////////////////////////////////////////////////
+
+#ifndef __RATE_LIMITER_PARALLEL_H
+#define __RATE_LIMITER_PARALLEL_H
+
+////////////////////////////////////////////////////////////////////////////////
+// Includes
+////////////////////////////////////////////////////////////////////////////////
+#include "rate_limiter.h"
+#include "rate_limiter_bank.h"
+
+////////////////////////////////////////////////////////////////////////////////
+// Definitions
+////////////////////////////////////////////////////////////////////////////////
+
+/**
+ * 	Enable multi-threaded bank update with persistent worker pool
+ *
+ * @note Requires POSIX threads. Can be overridden in "project_config.h".
+ *
+ * 	0 - Disabled
+ * 	1 - Enabled
+ */
+#ifndef RATE_LIMITER_PARALLEL_EN
+	#define RATE_LIMITER_PARALLEL_EN		( 0 )
+#endif
+
+/**
+ * 	Work stealing task size in channels
+ *
+ * @note Shall be multiple of 32 channels (one target mode bitmap word)
+ * 		and of channels per RATE_LIMITER_BANK_ALIGN. Grain is doubled for a
+ * 		tick when tasks would not fit into deques.
+ * 		Can be overridden in "project_config.h".
+ */
+#ifndef RATE_LIMITER_PARALLEL_GRAIN
+	#define RATE_LIMITER_PARALLEL_GRAIN		( 4096U )
+#endif
+
+/**
+ * 	Capacity of per thread work stealing deque
+ *
+ * @note Shall be power of two. Can be overridden in "project_config.h".
+ */
+#ifndef RATE_LIMITER_PARALLEL_DEQUE_SIZE
+	#define RATE_LIMITER_PARALLEL_DEQUE_SIZE	( 1024U )
+#endif
+
+/**
+ * 	Maximum number of jobs in single work stealing tick
+ */
+#define RATE_LIMITER_PARALLEL_MAX_JOBS		( 256U )
+
+#if ( 1 == RATE_LIMITER_PARALLEL_EN )
+
+/**
+ * 	Pointer to rate limiter worker pool
+ */
+typedef struct rate_limiter_parallel_s * p_rate_limiter_parallel_t;
+
+/**
+ * 	Job type
+ */
+typedef enum
+{
+	eRATE_LIMITER_PARALLEL_JOB_UPDATE = 0,		/**<Full update, as "rate_limiter_bank_update()" */
+	eRATE_LIMITER_PARALLEL_JOB_UPDATE_ACTIVE,	/**<Target mode update, as "rate_limiter_bank_update_active()" */
+} rate_limiter_parallel_job_type_t;
+
+/**
+ * 	Bank job of work stealing tick
+ */
+typedef struct
+{
+	p_rate_limiter_bank_t				bank;	/**<Rate limiter bank */
+	const float32_t *					p_x;	/**<Inputs, one per channel (full update only) */
+	float32_t *							p_y;	/**<Outputs, one per channel (full update only) */
+	rate_limiter_parallel_job_type_t	type;	/**<Job type */
+} rate_limiter_parallel_job_t;
+
+/**
+ * 	Per thread statistics of last work stealing tick
+ */
+typedef struct
+{
+	uint64_t	busy_ns;			/**<Time spent executing tasks */
+	uint32_t	num_of_tasks;		/**<Number of executed tasks */
+	uint32_t	num_of_stolen;		/**<Number of executed tasks stolen from other threads */
+	uint32_t	num_of_steal_fail;	/**<Number of failed steal attempts */
+} rate_limiter_parallel_thread_stats_t;
+
+/**
+ * 	Load balance statistics of last work stealing tick
+ */
+typedef struct
+{
+	uint64_t	tick_ns;			/**<Tick completion time seen by calling thread */
+	uint64_t	max_busy_ns;		/**<Busy time of most loaded thread */
+	uint64_t	min_busy_ns;		/**<Busy time of least loaded thread */
+	uint32_t	grain;				/**<Task size in channels */
+	uint32_t	num_of_tasks;		/**<Number of tasks */
+	uint32_t	num_of_stolen;		/**<Number of stolen tasks */
+} rate_limiter_parallel_stats_t;
+
+////////////////////////////////////////////////////////////////////////////////
+// Functions
+////////////////////////////////////////////////////////////////////////////////
+rate_limiter_status_t	rate_limiter_parallel_init			(p_rate_limiter_parallel_t * p_pool, const uint32_t num_of_threads, const int32_t * const p_cores);
+rate_limiter_status_t	rate_limiter_parallel_deinit		(p_rate_limiter_parallel_t * p_pool);
+bool					rate_limiter_parallel_is_init		(p_rate_limiter_parallel_t pool);
+rate_limiter_status_t	rate_limiter_bank_update_parallel	(p_rate_limiter_parallel_t pool, p_rate_limiter_bank_t bank, const float32_t * const p_x, float32_t * const p_y);
+rate_limiter_status_t	rate_limiter_parallel_run_jobs		(p_rate_limiter_parallel_t pool, const rate_limiter_parallel_job_t * const p_jobs, const uint32_t num_of_jobs);
+rate_limiter_status_t	rate_limiter_parallel_get_stats		(p_rate_limiter_parallel_t pool, rate_limiter_parallel_stats_t * const p_stats);
+rate_limiter_status_t	rate_limiter_parallel_get_thread_stats(p_rate_limiter_parallel_t pool, const uint32_t thread, rate_limiter_parallel_thread_stats_t * const p_stats);
+
+#endif // ( 1 == RATE_LIMITER_PARALLEL_EN )
+
+#endif // __RATE_LIMITER_PARALLEL_H
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+* @} <!-- END GROUP -->
+*/
+////////////////////////////////////////////////////////////////////////////////
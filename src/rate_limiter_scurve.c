@@ -0,0 +1,847 @@
+// Copyright (c) 2021 Ziga Miklosic
+// All Rights Reserved
+// This software is under MIT licence (https://opensource.org/licenses/MIT)
+////////////////////////////////////////////////////////////////////////////////
+/**
+*@file      rate_limiter_scurve.c
+*@brief     Jerk limited (S-curve) rate limiter
+*@author    Ziga Miklosic
+*@date      19.02.2021
+*@version   V1.1.0
+*
+*@section Description
+*
+*	Third order limiter for motion setpoints. Output follows input with
+*	limited rate (rise and fall slew rate as with rate limiter), limited
+*	acceleration and limited jerk, so that velocity profile has S-shaped
+*	edges. Profile is generated incrementally: every update chooses next
+*	jerk from current state only, at constant cost and without planning
+*	whole move in advance. Input may change at any time.
+*
+*	Update is cascade of two braking laws, in per period units:
+*
+*	1. Position: acceleration and velocity are first predicted at instant
+*	   when current acceleration is ramped to zero with jerk limit j. From
+*	   remaining distance e wanted velocity is the largest one from which
+*	   output still stops at input with limits a and j:
+*
+*		v = cbrt( j * e^2 ),					e <= a^3 / j^2
+*		v = sqrt( h^2 + 2 * a * e ) - h,		h = a^2 / ( 2 * j )
+*
+*	   limited by rise/fall slew rate factor.
+*
+*	2. Velocity: wanted acceleration is the largest one from which
+*	   velocity still reaches wanted velocity with jerk j (same discrete
+*	   law as second order limiter), limited by a and by previous
+*	   acceleration +/- j.
+*
+*	Braking laws assume continuous time, so they are planned with limits
+*	scaled by RATE_LIMITER_SCURVE_MARGIN to absorb discretization and
+*	avoid overshoot. Actual limits are never exceeded.
+*
+*	Output position is accumulated with compensation term, so that
+*	changes below float resolution of output are not lost at end of move.
+*	When remaining distance, velocity and acceleration are below jerk
+*	factor (or float resolution of input) output lands exactly on input.
+*
+*	Update is branchless, so bank kernel is vectorized by compiler once
+*	errno handling of sqrtf() is disabled (GCC/Clang -fno-math-errno).
+*
+*/
+////////////////////////////////////////////////////////////////////////////////
+/*!
+* @addtogroup RATE_LIMITER_SCURVE
+* @{ <!-- BEGIN GROUP -->
+*/
+////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////
+// Includes
+////////////////////////////////////////////////////////////////////////////////
+#include "rate_limiter_scurve.h"
+#include "rate_limiter_bank.h"
+#include "rate_limiter_kernel.h"
+
+#include <math.h>
+#include <float.h>
+
+////////////////////////////////////////////////////////////////////////////////
+// Definitions
+////////////////////////////////////////////////////////////////////////////////
+
+/**
+ * 	Initialization sentinel
+ */
+#define RATE_LIMITER_SCURVE_INIT_MAGIC		( 0x52534355UL )
+
+/**
+ * 	Scale of acceleration and jerk used for planning of braking
+ */
+#define RATE_LIMITER_SCURVE_MARGIN			( 0.8f )
+
+/**
+ * 	Number of channels per aligned array block
+ */
+#define RATE_LIMITER_SCURVE_CH_PER_ALIGN	( RATE_LIMITER_BANK_ALIGN / sizeof( float32_t ))
+
+/**
+ * 	Number of S-curve bank channel arrays
+ */
+#define RATE_LIMITER_SCURVE_NUM_OF_ARRAYS	( 8U )
+
+/**
+ * 	S-curve rate limiter bank
+ */
+typedef struct rate_limiter_scurve_bank_s
+{
+	float32_t *	p_x_prev;	/**<Previous outputs of channels */
+	float32_t *	p_x_res;	/**<Rounding compensations of channels */
+	float32_t *	p_v_prev;	/**<Previous output changes of channels */
+	float32_t *	p_a_prev;	/**<Previous accelerations of channels */
+	float32_t *	p_k_rise;	/**<Rising slew rate factors of channels */
+	float32_t * p_k_fall;	/**<Falling slew rate factors of channels */
+	float32_t * p_k_acc;	/**<Acceleration factors of channels */
+	float32_t * p_k_jerk;	/**<Jerk factors of channels */
+	void *		p_mem;		/**<Allocated memory space of channel arrays */
+	float32_t 	dt;			/**<Period of update */
+	uint32_t	num_of_ch;	/**<Number of channels */
+	bool		is_init;	/**<Rate limiter bank initialization success flag */
+} rate_limiter_scurve_bank_t;
+
+/**
+ * 	S-curve limits in per period units
+ */
+typedef struct
+{
+	float32_t	k_rise;		/**<Rising slew rate factor */
+	float32_t	k_fall;		/**<Falling slew rate factor */
+	float32_t	k_acc;		/**<Acceleration factor */
+	float32_t	k_jerk;		/**<Jerk factor */
+} rate_limiter_scurve_k_t;
+
+////////////////////////////////////////////////////////////////////////////////
+// Variables
+////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////
+// Function prototypes
+////////////////////////////////////////////////////////////////////////////////
+static inline float32_t	rate_limiter_scurve_cbrt		(const float32_t x);
+static inline float32_t	rate_limiter_scurve_brake_vel	(const float32_t dist, const float32_t k_acc, const float32_t k_jerk);
+static inline float32_t	rate_limiter_scurve_brake_acc	(const float32_t dv, const float32_t k_jerk);
+static inline float32_t	rate_limiter_scurve_limit		(const float32_t x, float32_t * const p_x_prev, float32_t * const p_x_res, float32_t * const p_v_prev, float32_t * const p_a_prev, const rate_limiter_scurve_k_t * const p_k);
+static void				rate_limiter_scurve_bank_kernel	(const float32_t * const p_x, float32_t * const p_y, float32_t * restrict p_x_prev, float32_t * restrict p_x_res, float32_t * restrict p_v_prev, float32_t * restrict p_a_prev, const float32_t * restrict p_k_rise, const float32_t * restrict p_k_fall, const float32_t * restrict p_k_acc, const float32_t * restrict p_k_jerk, const uint32_t num_of_ch);
+static bool				rate_limiter_scurve_check_rate	(const float32_t rise_rate, const float32_t fall_rate, const float32_t acc, const float32_t jerk);
+static void				rate_limiter_scurve_calc_k		(const float32_t dt, const float32_t rise_rate, const float32_t fall_rate, const float32_t acc, const float32_t jerk, rate_limiter_scurve_k_t * const p_k);
+
+////////////////////////////////////////////////////////////////////////////////
+// Functions
+////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////
+/*!
+* @brief    Cube root of not negative value
+*
+* @note Exponent of initial guess is divided by three on raw float bits,
+* 		then refined with two Newton steps to relative error below 2e-6,
+* 		which is far below braking margin. Unlike cbrtf() it is inlined
+* 		and vectorized by compiler.
+*
+* @param[in]  	x			- Input value, not negative
+* @return       y			- Cube root of input value
+*/
+////////////////////////////////////////////////////////////////////////////////
+static inline float32_t rate_limiter_scurve_cbrt(const float32_t x)
+{
+	rate_limiter_bits_t bits;
+	float32_t			y = 0.0f;
+
+	bits.f = x;
+	bits.u = (( bits.u / 3U ) + 0x2A5137A0U );
+	y = bits.f;
+
+	y = ((( 2.0f * y ) + ( x / ( y * y ))) * ( 1.0f / 3.0f ));
+	y = ((( 2.0f * y ) + ( x / ( y * y ))) * ( 1.0f / 3.0f ));
+
+	return y;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/*!
+* @brief    Velocity from which output stops within distance
+*
+* @note Continuous jerk limited braking starting with zero acceleration.
+* 		Under distance a^3/j^2 acceleration limit is not reached during
+* 		braking. Both branches are computed and selected afterwards.
+*
+* @param[in]  	dist		- Distance to stop, not negative
+* @param[in]  	k_acc		- Acceleration factor
+* @param[in]  	k_jerk		- Jerk factor
+* @return       v			- Braking velocity per period
+*/
+////////////////////////////////////////////////////////////////////////////////
+static inline float32_t rate_limiter_scurve_brake_vel(const float32_t dist, const float32_t k_acc, const float32_t k_jerk)
+{
+	const float32_t t_acc 	= ( k_acc / k_jerk );
+	const float32_t h		= ( 0.5f * k_acc * t_acc );
+	const float32_t v_jerk	= rate_limiter_scurve_cbrt( k_jerk * dist * dist );
+	const float32_t v_acc	= ( sqrtf(( h * h ) + ( 2.0f * k_acc * dist )) - h );
+
+	return rate_limiter_select(( dist <= ( 2.0f * h * t_acc )), v_jerk, v_acc );
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/*!
+* @brief    Acceleration from which velocity reaches wanted change
+*
+* @note Discrete law as used by second order limiter, never larger than
+* 		velocity difference, so velocity lands exactly.
+*
+* @param[in]  	dv			- Velocity difference, not negative
+* @param[in]  	k_jerk		- Jerk factor
+* @return       a			- Braking acceleration per period
+*/
+////////////////////////////////////////////////////////////////////////////////
+static inline float32_t rate_limiter_scurve_brake_acc(const float32_t dv, const float32_t k_jerk)
+{
+	const float32_t a = ( 0.5f * k_jerk * ( sqrtf( 1.0f + (( 8.0f * dv ) / k_jerk )) - 1.0f ));
+
+	return rate_limiter_select(( a > dv ), dv, a );
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/*!
+* @brief    Rate, acceleration and jerk limit input signal
+*
+* @note Shared between single sample, block and bank update, so all of
+* 		them give bit exact results. Limits are applied with select.
+*
+* @param[in]  		x			- Input signal
+* @param[in,out]  	p_x_prev	- Previous output
+* @param[in,out]  	p_x_res		- Rounding compensation of output
+* @param[in,out]  	p_v_prev	- Previous output change
+* @param[in,out]  	p_a_prev	- Previous acceleration
+* @param[in]  		p_k			- Limit factors
+* @return       	y			- Output (limited) signal
+*/
+////////////////////////////////////////////////////////////////////////////////
+static inline float32_t rate_limiter_scurve_limit(const float32_t x, float32_t * const p_x_prev, float32_t * const p_x_res, float32_t * const p_v_prev, float32_t * const p_a_prev, const rate_limiter_scurve_k_t * const p_k)
+{
+	const float32_t x_prev	= *p_x_prev;
+	const float32_t v_prev	= *p_v_prev;
+	const float32_t a_prev	= *p_a_prev;
+	const float32_t e 		= (( x - x_prev ) - *p_x_res );
+	const float32_t t_stop	= ( fabsf( a_prev ) / p_k->k_jerk );
+	const float32_t e_stop	= ( e - ( v_prev * t_stop ) - ( a_prev * t_stop * t_stop * ( 1.0f / 3.0f )));
+	const float32_t v_stop	= ( v_prev + (( a_prev * fabsf( a_prev )) / ( 2.0f * p_k->k_jerk )));
+	const float32_t eps		= ( p_k->k_jerk + ( FLT_EPSILON * fabsf( x )));
+	float32_t		v		= 0.0f;
+	float32_t		a		= 0.0f;
+	float32_t		v_sum	= 0.0f;
+	float32_t		y		= 0.0f;
+	bool			is_land	= false;
+
+	// Wanted velocity
+	v = rate_limiter_scurve_brake_vel( fabsf( e_stop ), ( RATE_LIMITER_SCURVE_MARGIN * p_k->k_acc ), ( RATE_LIMITER_SCURVE_MARGIN * p_k->k_jerk ));
+	v = rate_limiter_select(( v > fabsf( e_stop )), fabsf( e_stop ), v );
+	v = rate_limiter_select(( e_stop < 0.0f ), -v, v );
+	v = rate_limiter_select(( v > p_k->k_rise ), p_k->k_rise, v );
+	v = rate_limiter_select(( v < -( p_k->k_fall )), -( p_k->k_fall ), v );
+
+	// Wanted acceleration
+	a = rate_limiter_scurve_brake_acc( fabsf( v - v_stop ), p_k->k_jerk );
+	a = rate_limiter_select(( a > fabsf( v - v_prev )), fabsf( v - v_prev ), a );
+	a = rate_limiter_select(( v < v_stop ), -a, a );
+
+	// Acceleration and jerk limit
+	a = rate_limiter_select(( a > p_k->k_acc ), p_k->k_acc, a );
+	a = rate_limiter_select(( a < -( p_k->k_acc )), -( p_k->k_acc ), a );
+	a = rate_limiter_select(( a > ( a_prev + p_k->k_jerk )), ( a_prev + p_k->k_jerk ), a );
+	a = rate_limiter_select(( a < ( a_prev - p_k->k_jerk )), ( a_prev - p_k->k_jerk ), a );
+
+	v = ( v_prev + a );
+
+	// Compensated position sum
+	v_sum = ( v + *p_x_res );
+	y = ( x_prev + v_sum );
+
+	// Land on input once rest of move is below resolution (no short circuit, kept branchless)
+	is_land = 	(	( fabsf( e ) <= eps )
+				&	( fabsf( v_prev ) <= eps )
+				&	( fabsf( a_prev ) <= eps ));
+
+	*p_x_res = rate_limiter_select( is_land, 0.0f, ( v_sum - ( y - x_prev )));
+	*p_v_prev = rate_limiter_select( is_land, 0.0f, v );
+	*p_a_prev = rate_limiter_select( is_land, 0.0f, a );
+	*p_x_prev = rate_limiter_select( is_land, x, y );
+
+	return *p_x_prev;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/*!
+* @brief    Update all channels of S-curve bank
+*
+* @note State arrays are restrict parameters and are accessed through
+* 		locals, so only input and output buffer need run-time alias check
+* 		and compiler can vectorize loop.
+*
+* @param[in]  	p_x			- Pointer to input signals
+* @param[out]  	p_y			- Pointer to output (limited) signals
+* @param[in]  	p_x_prev	- Pointer to previous outputs
+* @param[in]  	p_x_res		- Pointer to rounding compensations
+* @param[in]  	p_v_prev	- Pointer to previous output changes
+* @param[in]  	p_a_prev	- Pointer to previous accelerations
+* @param[in]  	p_k_rise	- Pointer to rising slew rate factors
+* @param[in]  	p_k_fall	- Pointer to falling slew rate factors
+* @param[in]  	p_k_acc		- Pointer to acceleration factors
+* @param[in]  	p_k_jerk	- Pointer to jerk factors
+* @param[in]  	num_of_ch	- Number of channels
+* @return       void
+*/
+////////////////////////////////////////////////////////////////////////////////
+static void rate_limiter_scurve_bank_kernel(const float32_t * const p_x, float32_t * const p_y, float32_t * restrict p_x_prev, float32_t * restrict p_x_res, float32_t * restrict p_v_prev, float32_t * restrict p_a_prev, const float32_t * restrict p_k_rise, const float32_t * restrict p_k_fall, const float32_t * restrict p_k_acc, const float32_t * restrict p_k_jerk, const uint32_t num_of_ch)
+{
+	rate_limiter_scurve_k_t k;
+	float32_t				x_prev	= 0.0f;
+	float32_t				x_res	= 0.0f;
+	float32_t				v_prev	= 0.0f;
+	float32_t				a_prev	= 0.0f;
+	uint32_t				ch		= 0;
+
+	for ( ch = 0; ch < num_of_ch; ch++ )
+	{
+		k.k_rise = p_k_rise[ch];
+		k.k_fall = p_k_fall[ch];
+		k.k_acc = p_k_acc[ch];
+		k.k_jerk = p_k_jerk[ch];
+
+		x_prev = p_x_prev[ch];
+		x_res = p_x_res[ch];
+		v_prev = p_v_prev[ch];
+		a_prev = p_a_prev[ch];
+
+		p_y[ch] = rate_limiter_scurve_limit( p_x[ch], &x_prev, &x_res, &v_prev, &a_prev, &k );
+
+		p_x_prev[ch] = x_prev;
+		p_x_res[ch] = x_res;
+		p_v_prev[ch] = v_prev;
+		p_a_prev[ch] = a_prev;
+	}
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/*!
+* @brief    Check S-curve limiter rates
+*
+* @note Acceleration and jerk shall be positive as braking laws are
+* 		divided by them.
+*
+* @param[in]  	rise_rate	- Rising slew rate
+* @param[in]  	fall_rate	- Falling slew rate
+* @param[in]  	acc			- Acceleration limit
+* @param[in]  	jerk		- Jerk limit
+* @return       valid		- True when rates are valid
+*/
+////////////////////////////////////////////////////////////////////////////////
+static bool rate_limiter_scurve_check_rate(const float32_t rise_rate, const float32_t fall_rate, const float32_t acc, const float32_t jerk)
+{
+	return 	(	( rise_rate >= 0.0f )
+			&&	( fall_rate >= 0.0f )
+			&&	( acc > 0.0f )
+			&&	( jerk > 0.0f ));
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/*!
+* @brief    Calculate S-curve limit factors base on update time
+*
+* @param[in]  	dt			- Update (period) time
+* @param[in]  	rise_rate	- Rising slew rate
+* @param[in]  	fall_rate	- Falling slew rate
+* @param[in]  	acc			- Acceleration limit
+* @param[in]  	jerk		- Jerk limit
+* @param[out]  	p_k			- Limit factors
+* @return       void
+*/
+////////////////////////////////////////////////////////////////////////////////
+static void rate_limiter_scurve_calc_k(const float32_t dt, const float32_t rise_rate, const float32_t fall_rate, const float32_t acc, const float32_t jerk, rate_limiter_scurve_k_t * const p_k)
+{
+	p_k->k_rise = rate_limiter_calc_rate_factor( dt, rise_rate );
+	p_k->k_fall = rate_limiter_calc_rate_factor( dt, fall_rate );
+	p_k->k_acc = ( acc * dt * dt );
+	p_k->k_jerk = ( jerk * dt * dt * dt );
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+* @} <!-- END GROUP -->
+*/
+////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*@addtogroup RATE_LIMITER_SCURVE_API
+* @{ <!-- BEGIN GROUP -->
+*
+* 	Following function are part or S-curve rate limiter API.
+*/
+////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////
+/*!
+* @brief    Initialize S-curve rate limiter
+*
+* @note Instance memory is provided by user. Slew rate units are the same
+* 		as with "rate_limiter_init()", acceleration is in unit/sec^2 and
+* 		jerk in unit/sec^3.
+*
+* @param[out]  	p_inst		- Pointer to S-curve rate limiter instance
+* @param[in]  	rise_rate	- Rising slew rate
+* @param[in]  	fall_rate	- Falling slew rate
+* @param[in]  	acc			- Acceleration limit
+* @param[in]  	jerk		- Jerk limit
+* @param[in]  	dt			- Update (period) time
+* @return       status		- Either OK or Error
+*/
+////////////////////////////////////////////////////////////////////////////////
+rate_limiter_status_t rate_limiter_scurve_init(rate_limiter_scurve_t * const p_inst, const float32_t rise_rate, const float32_t fall_rate, const float32_t acc, const float32_t jerk, const float32_t dt)
+{
+	rate_limiter_status_t 	status = eRATE_LIMITER_OK;
+	rate_limiter_scurve_k_t	k;
+
+	if 	(	( NULL != p_inst )
+		&& 	( dt > 0.0f )
+		&&	( true == rate_limiter_scurve_check_rate( rise_rate, fall_rate, acc, jerk )))
+	{
+		rate_limiter_scurve_calc_k( dt, rise_rate, fall_rate, acc, jerk, &k );
+
+		p_inst->x_prev = 0.0f;
+		p_inst->x_res = 0.0f;
+		p_inst->v_prev = 0.0f;
+		p_inst->a_prev = 0.0f;
+		p_inst->dt = dt;
+		p_inst->k_rise = k.k_rise;
+		p_inst->k_fall = k.k_fall;
+		p_inst->k_acc = k.k_acc;
+		p_inst->k_jerk = k.k_jerk;
+
+		// Init success
+		p_inst->init = RATE_LIMITER_SCURVE_INIT_MAGIC;
+	}
+	else
+	{
+		status = eRATE_LIMITER_ERROR;
+	}
+
+	return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/*!
+* @brief    Update S-curve rate limiter
+*
+* @param[in]  	p_inst		- Pointer to S-curve rate limiter instance
+* @param[in]  	x			- Input signal
+* @return       y			- Output (limited) signal
+*/
+////////////////////////////////////////////////////////////////////////////////
+float32_t rate_limiter_scurve_update(rate_limiter_scurve_t * const p_inst, const float32_t x)
+{
+	float32_t 				y = 0.0f;
+	rate_limiter_scurve_k_t	k;
+
+	// Check for instance and initialization
+	if ( NULL != p_inst )
+	{
+		if ( RATE_LIMITER_SCURVE_INIT_MAGIC == p_inst->init )
+		{
+			k.k_rise = p_inst->k_rise;
+			k.k_fall = p_inst->k_fall;
+			k.k_acc = p_inst->k_acc;
+			k.k_jerk = p_inst->k_jerk;
+
+			y = rate_limiter_scurve_limit( x, &p_inst->x_prev, &p_inst->x_res, &p_inst->v_prev, &p_inst->a_prev, &k );
+		}
+	}
+
+	return y;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/*!
+* @brief    Update S-curve rate limiter over block of samples
+*
+* @note Input and output buffer may point to the same location.
+*
+* @param[in]  	p_inst		- Pointer to S-curve rate limiter instance
+* @param[in]  	p_x			- Pointer to input signal samples
+* @param[out]  	p_y			- Pointer to output (limited) signal samples
+* @param[in]  	size		- Number of samples in block
+* @return       status		- Either OK or Error
+*/
+////////////////////////////////////////////////////////////////////////////////
+rate_limiter_status_t rate_limiter_scurve_update_block(rate_limiter_scurve_t * const p_inst, const float32_t * const p_x, float32_t * const p_y, const size_t size)
+{
+	rate_limiter_status_t 	status 	= eRATE_LIMITER_ERROR;
+	rate_limiter_scurve_k_t	k;
+	float32_t				x_prev	= 0.0f;
+	float32_t				x_res	= 0.0f;
+	float32_t				v_prev	= 0.0f;
+	float32_t				a_prev	= 0.0f;
+	size_t					i		= 0;
+
+	// Check for instance, initialization and buffers
+	if 	(	( NULL != p_inst )
+		&&	( NULL != p_x )
+		&&	( NULL != p_y ))
+	{
+		if ( RATE_LIMITER_SCURVE_INIT_MAGIC == p_inst->init )
+		{
+			k.k_rise = p_inst->k_rise;
+			k.k_fall = p_inst->k_fall;
+			k.k_acc = p_inst->k_acc;
+			k.k_jerk = p_inst->k_jerk;
+
+			// Keep state in registers over block
+			x_prev = p_inst->x_prev;
+			x_res = p_inst->x_res;
+			v_prev = p_inst->v_prev;
+			a_prev = p_inst->a_prev;
+
+			for ( i = 0; i < size; i++ )
+			{
+				p_y[i] = rate_limiter_scurve_limit( p_x[i], &x_prev, &x_res, &v_prev, &a_prev, &k );
+			}
+
+			p_inst->x_prev = x_prev;
+			p_inst->x_res = x_res;
+			p_inst->v_prev = v_prev;
+			p_inst->a_prev = a_prev;
+
+			status = eRATE_LIMITER_OK;
+		}
+	}
+
+	return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/*!
+* @brief    Get success initialization flag of S-curve rate limiter
+*
+* @param[in]  	p_inst		- Pointer to S-curve rate limiter instance
+* @return       is_init		- Success initialization flag
+*/
+////////////////////////////////////////////////////////////////////////////////
+bool rate_limiter_scurve_is_init(const rate_limiter_scurve_t * const p_inst)
+{
+	bool is_init = false;
+
+	if ( NULL != p_inst )
+	{
+		is_init = ( RATE_LIMITER_SCURVE_INIT_MAGIC == p_inst->init );
+	}
+
+	return is_init;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/*!
+* @brief    Change limits of S-curve rate limiter
+*
+* @note Output state is kept, so change takes effect smoothly.
+*
+* @param[in]  	p_inst		- Pointer to S-curve rate limiter instance
+* @param[in]  	rise_rate	- Rising slew rate
+* @param[in]  	fall_rate	- Falling slew rate
+* @param[in]  	acc			- Acceleration limit
+* @param[in]  	jerk		- Jerk limit
+* @return       status		- Either OK or Error
+*/
+////////////////////////////////////////////////////////////////////////////////
+rate_limiter_status_t rate_limiter_scurve_change_rate(rate_limiter_scurve_t * const p_inst, const float32_t rise_rate, const float32_t fall_rate, const float32_t acc, const float32_t jerk)
+{
+	rate_limiter_status_t 	status = eRATE_LIMITER_ERROR;
+	rate_limiter_scurve_k_t	k;
+
+	// Check for instance, initialization and rates
+	if 	(	( true == rate_limiter_scurve_is_init( p_inst ))
+		&&	( true == rate_limiter_scurve_check_rate( rise_rate, fall_rate, acc, jerk )))
+	{
+		rate_limiter_scurve_calc_k( p_inst->dt, rise_rate, fall_rate, acc, jerk, &k );
+
+		p_inst->k_rise = k.k_rise;
+		p_inst->k_fall = k.k_fall;
+		p_inst->k_acc = k.k_acc;
+		p_inst->k_jerk = k.k_jerk;
+
+		status = eRATE_LIMITER_OK;
+	}
+
+	return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/*!
+* @brief    Get current rate of S-curve rate limiter output
+*
+* @param[in]  	p_inst		- Pointer to S-curve rate limiter instance
+* @return       rate		- Output rate in unit/sec
+*/
+////////////////////////////////////////////////////////////////////////////////
+float32_t rate_limiter_scurve_get_rate(const rate_limiter_scurve_t * const p_inst)
+{
+	float32_t rate = 0.0f;
+
+	if ( true == rate_limiter_scurve_is_init( p_inst ))
+	{
+		rate = ( p_inst->v_prev / p_inst->dt );
+	}
+
+	return rate;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/*!
+* @brief    Get current acceleration of S-curve rate limiter output
+*
+* @param[in]  	p_inst		- Pointer to S-curve rate limiter instance
+* @return       acc			- Output acceleration in unit/sec^2
+*/
+////////////////////////////////////////////////////////////////////////////////
+float32_t rate_limiter_scurve_get_acc(const rate_limiter_scurve_t * const p_inst)
+{
+	float32_t acc = 0.0f;
+
+	if ( true == rate_limiter_scurve_is_init( p_inst ))
+	{
+		acc = ( p_inst->a_prev / ( p_inst->dt * p_inst->dt ));
+	}
+
+	return acc;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/*!
+* @brief    Initialize S-curve rate limiter bank
+*
+* @param[out]  	p_bank		- Pointer to S-curve rate limiter bank
+* @param[in]  	num_of_ch	- Number of channels
+* @param[in]  	rise_rate	- Rising slew rate
+* @param[in]  	fall_rate	- Falling slew rate
+* @param[in]  	acc			- Acceleration limit
+* @param[in]  	jerk		- Jerk limit
+* @param[in]  	dt			- Update (period) time
+* @return       status		- Either OK or Error
+*/
+////////////////////////////////////////////////////////////////////////////////
+rate_limiter_status_t rate_limiter_scurve_bank_init(p_rate_limiter_scurve_bank_t * p_bank, const uint32_t num_of_ch, const float32_t rise_rate, const float32_t fall_rate, const float32_t acc, const float32_t jerk, const float32_t dt)
+{
+	rate_limiter_status_t 	status 		= eRATE_LIMITER_OK;
+	rate_limiter_scurve_k_t	k;
+	uint32_t				stride		= 0;
+	uintptr_t				addr		= 0;
+	uint32_t				ch			= 0;
+
+	if 	(	( NULL != p_bank )
+		&&	( num_of_ch > 0U )
+		&& 	( dt > 0.0f )
+		&&	( true == rate_limiter_scurve_check_rate( rise_rate, fall_rate, acc, jerk )))
+	{
+		// Allocate space
+		*p_bank = malloc( sizeof( rate_limiter_scurve_bank_t ));
+
+		if ( NULL != *p_bank )
+		{
+			// Round array length up to whole aligned blocks
+			stride = (( num_of_ch + RATE_LIMITER_SCURVE_CH_PER_ALIGN - 1U ) / RATE_LIMITER_SCURVE_CH_PER_ALIGN ) * RATE_LIMITER_SCURVE_CH_PER_ALIGN;
+
+			// Allocate all arrays as single block with spare space for alignment
+			(*p_bank)->p_mem = malloc(( RATE_LIMITER_SCURVE_NUM_OF_ARRAYS * stride * sizeof( float32_t )) + RATE_LIMITER_BANK_ALIGN );
+
+			if ( NULL != (*p_bank)->p_mem )
+			{
+				// Align arrays
+				addr = ((uintptr_t) (*p_bank)->p_mem + RATE_LIMITER_BANK_ALIGN - 1U ) & ~((uintptr_t) RATE_LIMITER_BANK_ALIGN - 1U );
+
+				(*p_bank)->p_x_prev = (float32_t*) addr;
+				(*p_bank)->p_x_res = (*p_bank)->p_x_prev + stride;
+				(*p_bank)->p_v_prev = (*p_bank)->p_x_res + stride;
+				(*p_bank)->p_a_prev = (*p_bank)->p_v_prev + stride;
+				(*p_bank)->p_k_rise = (*p_bank)->p_a_prev + stride;
+				(*p_bank)->p_k_fall = (*p_bank)->p_k_rise + stride;
+				(*p_bank)->p_k_acc = (*p_bank)->p_k_fall + stride;
+				(*p_bank)->p_k_jerk = (*p_bank)->p_k_acc + stride;
+
+				rate_limiter_scurve_calc_k( dt, rise_rate, fall_rate, acc, jerk, &k );
+
+				// Init channels
+				for ( ch = 0; ch < stride; ch++ )
+				{
+					(*p_bank)->p_x_prev[ch] = 0.0f;
+					(*p_bank)->p_x_res[ch] = 0.0f;
+					(*p_bank)->p_v_prev[ch] = 0.0f;
+					(*p_bank)->p_a_prev[ch] = 0.0f;
+					(*p_bank)->p_k_rise[ch] = k.k_rise;
+					(*p_bank)->p_k_fall[ch] = k.k_fall;
+					(*p_bank)->p_k_acc[ch] = k.k_acc;
+					(*p_bank)->p_k_jerk[ch] = k.k_jerk;
+				}
+
+				(*p_bank)->dt = dt;
+				(*p_bank)->num_of_ch = num_of_ch;
+
+				// Init success
+				(*p_bank)->is_init = true;
+			}
+			else
+			{
+				free( *p_bank );
+				*p_bank = NULL;
+
+				status = eRATE_LIMITER_ERROR;
+			}
+		}
+		else
+		{
+			status = eRATE_LIMITER_ERROR;
+		}
+	}
+	else
+	{
+		status = eRATE_LIMITER_ERROR;
+	}
+
+	return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/*!
+* @brief    De-initialize S-curve rate limiter bank
+*
+* @param[in,out]  	p_bank		- Pointer to S-curve rate limiter bank
+* @return       	status		- Either OK or Error
+*/
+////////////////////////////////////////////////////////////////////////////////
+rate_limiter_status_t rate_limiter_scurve_bank_deinit(p_rate_limiter_scurve_bank_t * p_bank)
+{
+	rate_limiter_status_t status = eRATE_LIMITER_ERROR;
+
+	// Check for bank and initialization
+	if ( NULL != p_bank )
+	{
+		if ( true == rate_limiter_scurve_bank_is_init( *p_bank ))
+		{
+			(*p_bank)->is_init = false;
+
+			free( (*p_bank)->p_mem );
+			free( *p_bank );
+
+			*p_bank = NULL;
+
+			status = eRATE_LIMITER_OK;
+		}
+	}
+
+	return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/*!
+* @brief    Update all channels of S-curve rate limiter bank
+*
+* @note Input and output buffer must hold at least number of channels
+* 		samples and may point to the same location. All channel arrays
+* 		are read and written in single pass.
+*
+* @param[in]  	bank		- Pointer to S-curve rate limiter bank
+* @param[in]  	p_x			- Pointer to input signals, one per channel
+* @param[out]  	p_y			- Pointer to output (limited) signals, one per channel
+* @return       status		- Either OK or Error
+*/
+////////////////////////////////////////////////////////////////////////////////
+rate_limiter_status_t rate_limiter_scurve_bank_update(p_rate_limiter_scurve_bank_t bank, const float32_t * const p_x, float32_t * const p_y)
+{
+	rate_limiter_status_t status = eRATE_LIMITER_ERROR;
+
+	// Check for bank, initialization and buffers
+	if 	(	( NULL != bank )
+		&&	( NULL != p_x )
+		&&	( NULL != p_y ))
+	{
+		if ( true == bank->is_init )
+		{
+			rate_limiter_scurve_bank_kernel( p_x, p_y, bank->p_x_prev, bank->p_x_res, bank->p_v_prev, bank->p_a_prev, bank->p_k_rise, bank->p_k_fall, bank->p_k_acc, bank->p_k_jerk, bank->num_of_ch );
+
+			status = eRATE_LIMITER_OK;
+		}
+	}
+
+	return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/*!
+* @brief    Get success initialization flag of S-curve bank
+*
+* @param[in]  	bank		- Pointer to S-curve rate limiter bank
+* @return       is_init		- Success initialization flag
+*/
+////////////////////////////////////////////////////////////////////////////////
+bool rate_limiter_scurve_bank_is_init(p_rate_limiter_scurve_bank_t bank)
+{
+	bool is_init = false;
+
+	if ( NULL != bank )
+	{
+		is_init = bank->is_init;
+	}
+
+	return is_init;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/*!
+* @brief    Change limits of single S-curve bank channel
+*
+* @param[in]  	bank		- Pointer to S-curve rate limiter bank
+* @param[in]  	ch			- Channel index
+* @param[in]  	rise_rate	- Rising slew rate
+* @param[in]  	fall_rate	- Falling slew rate
+* @param[in]  	acc			- Acceleration limit
+* @param[in]  	jerk		- Jerk limit
+* @return       status		- Either OK or Error
+*/
+////////////////////////////////////////////////////////////////////////////////
+rate_limiter_status_t rate_limiter_scurve_bank_change_rate(p_rate_limiter_scurve_bank_t bank, const uint32_t ch, const float32_t rise_rate, const float32_t fall_rate, const float32_t acc, const float32_t jerk)
+{
+	rate_limiter_status_t 	status = eRATE_LIMITER_ERROR;
+	rate_limiter_scurve_k_t	k;
+
+	// Check for bank, initialization, channel and rates
+	if ( NULL != bank )
+	{
+		if 	(	( true == bank->is_init )
+			&&	( ch < bank->num_of_ch )
+			&&	( true == rate_limiter_scurve_check_rate( rise_rate, fall_rate, acc, jerk )))
+		{
+			rate_limiter_scurve_calc_k( bank->dt, rise_rate, fall_rate, acc, jerk, &k );
+
+			bank->p_k_rise[ch] = k.k_rise;
+			bank->p_k_fall[ch] = k.k_fall;
+			bank->p_k_acc[ch] = k.k_acc;
+			bank->p_k_jerk[ch] = k.k_jerk;
+
+			status = eRATE_LIMITER_OK;
+		}
+	}
+
+	return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+* @} <!-- END GROUP -->
+*/
+////////////////////////////////////////////////////////////////////////////////
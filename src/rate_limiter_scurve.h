@@ -0,0 +1,80 @@
+// Copyright (c) 2021 Ziga Miklosic
+// All Rights Reserved
+// This software is under MIT licence (https://opensource.org/licenses/MIT)
+////////////////////////////////////////////////////////////////////////////////
+/**
+*@file      rate_limiter_scurve.h
+*@brief     Jerk limited (S-curve) rate limiter
+*@author    Ziga Miklosic
+*@date      19.02.2021
+*@version   V1.1.0
+*/
+////////////////////////////////////////////////////////////////////////////////
+/**
+*@addtogroup RATE_LIMITER_SCURVE_API
+* @{ <!-- BEGIN GROUP -->
+*
+*/
+////////////////////////////////////////////////////////////////////////////////
+
+#ifndef __RATE_LIMITER_SCURVE_H
+#define __RATE_LIMITER_SCURVE_H
+
+////////////////////////////////////////////////////////////////////////////////
+// Includes
+////////////////////////////////////////////////////////////////////////////////
+#include "rate_limiter.h"
+
+////////////////////////////////////////////////////////////////////////////////
+// Definitions
+////////////////////////////////////////////////////////////////////////////////
+
+/**
+ * 	Jerk limited (S-curve) rate limiter
+ *
+ * @note Instance is owned by user and fields shall only be accessed by
+ * 		"rate_limiter_scurve_" functions.
+ */
+typedef struct
+{
+	float32_t	x_prev;		/**<Previous value of output */
+	float32_t	x_res;		/**<Part of output position lost to rounding of x_prev */
+	float32_t	v_prev;		/**<Previous output change per period */
+	float32_t	a_prev;		/**<Previous change of output change per period */
+	float32_t	k_rise;		/**<Rising slew rate factor */
+	float32_t	k_fall;		/**<Falling slew rate factor */
+	float32_t	k_acc;		/**<Acceleration factor */
+	float32_t	k_jerk;		/**<Jerk factor */
+	float32_t	dt;			/**<Period of update */
+	uint32_t	init;		/**<Initialization sentinel */
+} rate_limiter_scurve_t;
+
+/**
+ * 	Pointer to S-curve rate limiter bank
+ */
+typedef struct rate_limiter_scurve_bank_s * p_rate_limiter_scurve_bank_t;
+
+////////////////////////////////////////////////////////////////////////////////
+// Functions
+////////////////////////////////////////////////////////////////////////////////
+rate_limiter_status_t	rate_limiter_scurve_init		(rate_limiter_scurve_t * const p_inst, const float32_t rise_rate, const float32_t fall_rate, const float32_t acc, const float32_t jerk, const float32_t dt);
+float32_t				rate_limiter_scurve_update		(rate_limiter_scurve_t * const p_inst, const float32_t x);
+rate_limiter_status_t	rate_limiter_scurve_update_block(rate_limiter_scurve_t * const p_inst, const float32_t * const p_x, float32_t * const p_y, const size_t size);
+bool					rate_limiter_scurve_is_init		(const rate_limiter_scurve_t * const p_inst);
+rate_limiter_status_t	rate_limiter_scurve_change_rate	(rate_limiter_scurve_t * const p_inst, const float32_t rise_rate, const float32_t fall_rate, const float32_t acc, const float32_t jerk);
+float32_t				rate_limiter_scurve_get_rate	(const rate_limiter_scurve_t * const p_inst);
+float32_t				rate_limiter_scurve_get_acc		(const rate_limiter_scurve_t * const p_inst);
+
+rate_limiter_status_t	rate_limiter_scurve_bank_init		(p_rate_limiter_scurve_bank_t * p_bank, const uint32_t num_of_ch, const float32_t rise_rate, const float32_t fall_rate, const float32_t acc, const float32_t jerk, const float32_t dt);
+rate_limiter_status_t	rate_limiter_scurve_bank_deinit		(p_rate_limiter_scurve_bank_t * p_bank);
+rate_limiter_status_t	rate_limiter_scurve_bank_update		(p_rate_limiter_scurve_bank_t bank, const float32_t * const p_x, float32_t * const p_y);
+bool					rate_limiter_scurve_bank_is_init	(p_rate_limiter_scurve_bank_t bank);
+rate_limiter_status_t	rate_limiter_scurve_bank_change_rate(p_rate_limiter_scurve_bank_t bank, const uint32_t ch, const float32_t rise_rate, const float32_t fall_rate, const float32_t acc, const float32_t jerk);
+
+#endif // __RATE_LIMITER_SCURVE_H
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+* @} <!-- END GROUP -->
+*/
+////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,779 @@
+// Copyright (c) 2021 Ziga Miklosic
+// All Rights Reserved
+// This software is under MIT licence (https://opensource.org/licenses/MIT)
+////////////////////////////////////////////////////////////////////////////////
+/**
+*@file      rate_limiter_simd.c
+*@brief     Rate limiter SIMD kernels with runtime CPU dispatch
+*@author    Ziga Miklosic
+*@date      19.02.2021
+*@version   V1.1.0
+*
+*@section Description
+*
+*	Hand written x86 SSE4.1, AVX2 and AVX-512 kernels for rate limiter
+*	bank update. Each kernel processes 4, 8 or 16 channels at once with
+*	compare & blend, exactly as "rate_limiter_limit_sel()" does, thus
+*	results are bit exact to the scalar path. Channels that do not fill
+*	a complete vector are handled with masked load/store (AVX2, AVX-512)
+*	or with scalar kernel (SSE4.1).
+*
+*	Kernels are compiled with GCC/Clang target attributes, so that whole
+*	module can be built for baseline ISA and best available kernel is
+*	selected on running CPU.
+*
+*	Q15 bank kernels (AVX2, AVX-512BW) process 16 or 32 channels at once
+*	with saturating add/sub and packed min/max, exactly as
+*	"rate_limiter_q15_limit_sat()" does.
+*
+*	16-bit storage bank kernels widen fp16 state with F16C (AVX) or
+*	AVX-512F conversions and bf16 state with AVX2 shifts, compute in
+*	float and round back to nearest even, exactly as software conversions
+*	in "rate_limiter_kernel.h" do, including sub-ulp remainder of moving
+*	channels. Remaining channels are handled with scalar code.
+*
+*	Enabled with RATE_LIMITER_BANK_SIMD_EN. On other architectures or
+*	compilers no kernel is provided and bank uses scalar update.
+*
+*/
+////////////////////////////////////////////////////////////////////////////////
+/*!
+* @addtogroup RATE_LIMITER_SIMD
+* @{ <!-- BEGIN GROUP -->
+*/
+////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////
+// Includes
+////////////////////////////////////////////////////////////////////////////////
+#include "rate_limiter_simd.h"
+#include "rate_limiter_bank.h"
+#include "rate_limiter_kernel.h"
+
+#if ( 1 == RATE_LIMITER_BANK_SIMD_EN )
+
+#if ( defined( __GNUC__ ) && ( defined( __x86_64__ ) || defined( __i386__ )))
+	#include <immintrin.h>
+	#define RATE_LIMITER_SIMD_X86		( 1 )
+#else
+	#define RATE_LIMITER_SIMD_X86		( 0 )
+#endif
+
+////////////////////////////////////////////////////////////////////////////////
+// Definitions
+////////////////////////////////////////////////////////////////////////////////
+
+#if ( 1 == RATE_LIMITER_SIMD_X86 )
+
+/**
+ * 	Float sign bit mask
+ */
+#define RATE_LIMITER_SIMD_SIGN_MASK		( -0.0f )
+
+////////////////////////////////////////////////////////////////////////////////
+// Function prototypes
+////////////////////////////////////////////////////////////////////////////////
+static void rate_limiter_simd_sse41	(const float32_t * const p_x, float32_t * const p_y, float32_t * const p_x_prev, const float32_t * const p_k_rise, const float32_t * const p_k_fall, const uint32_t num_of_ch);
+static void rate_limiter_simd_avx2	(const float32_t * const p_x, float32_t * const p_y, float32_t * const p_x_prev, const float32_t * const p_k_rise, const float32_t * const p_k_fall, const uint32_t num_of_ch);
+static void rate_limiter_simd_avx512(const float32_t * const p_x, float32_t * const p_y, float32_t * const p_x_prev, const float32_t * const p_k_rise, const float32_t * const p_k_fall, const uint32_t num_of_ch);
+static void rate_limiter_simd_q15_avx2	(const int16_t * const p_x, int16_t * const p_y, int16_t * const p_x_prev, const int16_t * const p_k_rise, const int16_t * const p_k_fall, const uint32_t num_of_ch);
+static void rate_limiter_simd_q15_avx512(const int16_t * const p_x, int16_t * const p_y, int16_t * const p_x_prev, const int16_t * const p_k_rise, const int16_t * const p_k_fall, const uint32_t num_of_ch);
+static void rate_limiter_simd_fp16_f16c	(const float32_t * const p_x, float32_t * const p_y, uint16_t * const p_x_prev, int16_t * const p_x_res, const uint16_t * const p_k_rise, const uint16_t * const p_k_fall, const uint32_t num_of_ch);
+static void rate_limiter_simd_fp16_avx512(const float32_t * const p_x, float32_t * const p_y, uint16_t * const p_x_prev, int16_t * const p_x_res, const uint16_t * const p_k_rise, const uint16_t * const p_k_fall, const uint32_t num_of_ch);
+static void rate_limiter_simd_bf16_avx2	(const float32_t * const p_x, float32_t * const p_y, uint16_t * const p_x_prev, int16_t * const p_x_res, const uint16_t * const p_k_rise, const uint16_t * const p_k_fall, const uint32_t num_of_ch);
+static inline __m128i rate_limiter_simd_mask_to_epi16	(const __m256 mask);
+static inline __m256i rate_limiter_simd_f32_to_bf16		(const __m256 x);
+static inline __m256 rate_limiter_simd_fp16_res_lsb_f16c	(const __m128i h);
+static inline __m512 rate_limiter_simd_fp16_res_lsb_avx512	(const __m512i h);
+static inline __m256 rate_limiter_simd_bf16_res_lsb_avx2	(const __m256i h);
+
+////////////////////////////////////////////////////////////////////////////////
+// Functions
+////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////
+/*!
+* @brief    Bank update kernel, SSE4.1, 4 channels per step
+*
+* @param[in]  	p_x			- Pointer to input signals
+* @param[out]  	p_y			- Pointer to output (slew limited) signals
+* @param[in]  	p_x_prev	- Pointer to previous values
+* @param[in]  	p_k_rise	- Pointer to rising slew rate factors
+* @param[in]  	p_k_fall	- Pointer to falling slew rate factors
+* @param[in]  	num_of_ch	- Number of channels
+* @return       void
+*/
+////////////////////////////////////////////////////////////////////////////////
+__attribute__(( target( "sse4.1" )))
+static void rate_limiter_simd_sse41(const float32_t * const p_x, float32_t * const p_y, float32_t * const p_x_prev, const float32_t * const p_k_rise, const float32_t * const p_k_fall, const uint32_t num_of_ch)
+{
+	const __m128 	sign 	= _mm_set1_ps( RATE_LIMITER_SIMD_SIGN_MASK );
+	__m128			x, x_prev, k_rise, k_fall, dx, y;
+	uint32_t		ch 		= 0;
+
+	for ( ch = 0; ( ch + 4U ) <= num_of_ch; ch += 4U )
+	{
+		x 		= _mm_loadu_ps( &p_x[ch] );
+		x_prev 	= _mm_loadu_ps( &p_x_prev[ch] );
+		k_rise 	= _mm_loadu_ps( &p_k_rise[ch] );
+		k_fall 	= _mm_loadu_ps( &p_k_fall[ch] );
+
+		dx = _mm_sub_ps( x, x_prev );
+
+		// Falling limit first, rising limit has precedence
+		y = _mm_blendv_ps( x, _mm_sub_ps( x_prev, k_fall ), _mm_cmple_ps( dx, _mm_xor_ps( k_fall, sign )));
+		y = _mm_blendv_ps( y, _mm_add_ps( x_prev, k_rise ), _mm_cmpge_ps( dx, k_rise ));
+
+		_mm_storeu_ps( &p_x_prev[ch], y );
+		_mm_storeu_ps( &p_y[ch], y );
+	}
+
+	// Remaining channels
+	for ( ; ch < num_of_ch; ch++ )
+	{
+		p_x_prev[ch] = rate_limiter_limit_sel( p_x[ch], p_x_prev[ch], p_k_rise[ch], p_k_fall[ch] );
+		p_y[ch] = p_x_prev[ch];
+	}
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/*!
+* @brief    Bank update kernel, AVX2, 8 channels per step
+*
+* @param[in]  	p_x			- Pointer to input signals
+* @param[out]  	p_y			- Pointer to output (slew limited) signals
+* @param[in]  	p_x_prev	- Pointer to previous values
+* @param[in]  	p_k_rise	- Pointer to rising slew rate factors
+* @param[in]  	p_k_fall	- Pointer to falling slew rate factors
+* @param[in]  	num_of_ch	- Number of channels
+* @return       void
+*/
+////////////////////////////////////////////////////////////////////////////////
+__attribute__(( target( "avx2" )))
+static void rate_limiter_simd_avx2(const float32_t * const p_x, float32_t * const p_y, float32_t * const p_x_prev, const float32_t * const p_k_rise, const float32_t * const p_k_fall, const uint32_t num_of_ch)
+{
+	const __m256 	sign 	= _mm256_set1_ps( RATE_LIMITER_SIMD_SIGN_MASK );
+	__m256			x, x_prev, k_rise, k_fall, dx, y;
+	__m256i			mask;
+	uint32_t		ch 		= 0;
+
+	for ( ch = 0; ( ch + 8U ) <= num_of_ch; ch += 8U )
+	{
+		x 		= _mm256_loadu_ps( &p_x[ch] );
+		x_prev 	= _mm256_loadu_ps( &p_x_prev[ch] );
+		k_rise 	= _mm256_loadu_ps( &p_k_rise[ch] );
+		k_fall 	= _mm256_loadu_ps( &p_k_fall[ch] );
+
+		dx = _mm256_sub_ps( x, x_prev );
+
+		// Falling limit first, rising limit has precedence
+		y = _mm256_blendv_ps( x, _mm256_sub_ps( x_prev, k_fall ), _mm256_cmp_ps( dx, _mm256_xor_ps( k_fall, sign ), _CMP_LE_OQ ));
+		y = _mm256_blendv_ps( y, _mm256_add_ps( x_prev, k_rise ), _mm256_cmp_ps( dx, k_rise, _CMP_GE_OQ ));
+
+		_mm256_storeu_ps( &p_x_prev[ch], y );
+		_mm256_storeu_ps( &p_y[ch], y );
+	}
+
+	// Remaining channels with masked load/store
+	if ( ch < num_of_ch )
+	{
+		mask = _mm256_cmpgt_epi32( _mm256_set1_epi32((int32_t)( num_of_ch - ch )), _mm256_setr_epi32( 0, 1, 2, 3, 4, 5, 6, 7 ));
+
+		x 		= _mm256_maskload_ps( &p_x[ch], mask );
+		x_prev 	= _mm256_maskload_ps( &p_x_prev[ch], mask );
+		k_rise 	= _mm256_maskload_ps( &p_k_rise[ch], mask );
+		k_fall 	= _mm256_maskload_ps( &p_k_fall[ch], mask );
+
+		dx = _mm256_sub_ps( x, x_prev );
+
+		y = _mm256_blendv_ps( x, _mm256_sub_ps( x_prev, k_fall ), _mm256_cmp_ps( dx, _mm256_xor_ps( k_fall, sign ), _CMP_LE_OQ ));
+		y = _mm256_blendv_ps( y, _mm256_add_ps( x_prev, k_rise ), _mm256_cmp_ps( dx, k_rise, _CMP_GE_OQ ));
+
+		_mm256_maskstore_ps( &p_x_prev[ch], mask, y );
+		_mm256_maskstore_ps( &p_y[ch], mask, y );
+	}
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/*!
+* @brief    Bank update kernel, AVX-512, 16 channels per step
+*
+* @param[in]  	p_x			- Pointer to input signals
+* @param[out]  	p_y			- Pointer to output (slew limited) signals
+* @param[in]  	p_x_prev	- Pointer to previous values
+* @param[in]  	p_k_rise	- Pointer to rising slew rate factors
+* @param[in]  	p_k_fall	- Pointer to falling slew rate factors
+* @param[in]  	num_of_ch	- Number of channels
+* @return       void
+*/
+////////////////////////////////////////////////////////////////////////////////
+__attribute__(( target( "avx512f" )))
+static void rate_limiter_simd_avx512(const float32_t * const p_x, float32_t * const p_y, float32_t * const p_x_prev, const float32_t * const p_k_rise, const float32_t * const p_k_fall, const uint32_t num_of_ch)
+{
+	__m512		x, x_prev, k_rise, k_fall, dx, y;
+	__mmask16	mask 	= 0xFFFFU;
+	uint32_t	ch 		= 0;
+
+	for ( ch = 0; ch < num_of_ch; ch += 16U )
+	{
+		// Mask out channels past the end
+		if (( num_of_ch - ch ) < 16U )
+		{
+			mask = (__mmask16)(( 1U << ( num_of_ch - ch )) - 1U );
+		}
+
+		x 		= _mm512_maskz_loadu_ps( mask, &p_x[ch] );
+		x_prev 	= _mm512_maskz_loadu_ps( mask, &p_x_prev[ch] );
+		k_rise 	= _mm512_maskz_loadu_ps( mask, &p_k_rise[ch] );
+		k_fall 	= _mm512_maskz_loadu_ps( mask, &p_k_fall[ch] );
+
+		dx = _mm512_sub_ps( x, x_prev );
+
+		// Falling limit first, rising limit has precedence
+		y = _mm512_mask_blend_ps( _mm512_cmp_ps_mask( dx, _mm512_sub_ps( _mm512_setzero_ps(), k_fall ), _CMP_LE_OQ ), x, _mm512_sub_ps( x_prev, k_fall ));
+		y = _mm512_mask_blend_ps( _mm512_cmp_ps_mask( dx, k_rise, _CMP_GE_OQ ), y, _mm512_add_ps( x_prev, k_rise ));
+
+		_mm512_mask_storeu_ps( &p_x_prev[ch], mask, y );
+		_mm512_mask_storeu_ps( &p_y[ch], mask, y );
+	}
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/*!
+* @brief    Q15 bank update kernel, AVX2, 16 channels per step
+*
+* @param[in]  	p_x			- Pointer to input signals
+* @param[out]  	p_y			- Pointer to output (slew limited) signals
+* @param[in]  	p_x_prev	- Pointer to previous values
+* @param[in]  	p_k_rise	- Pointer to rising slew rate factors
+* @param[in]  	p_k_fall	- Pointer to falling slew rate factors
+* @param[in]  	num_of_ch	- Number of channels
+* @return       void
+*/
+////////////////////////////////////////////////////////////////////////////////
+__attribute__(( target( "avx2" )))
+static void rate_limiter_simd_q15_avx2(const int16_t * const p_x, int16_t * const p_y, int16_t * const p_x_prev, const int16_t * const p_k_rise, const int16_t * const p_k_fall, const uint32_t num_of_ch)
+{
+	const __m256i 	zero 	= _mm256_setzero_si256();
+	__m256i			x, x_prev, k_rise, k_fall, dx, y;
+	uint32_t		ch 		= 0;
+
+	for ( ch = 0; ( ch + 16U ) <= num_of_ch; ch += 16U )
+	{
+		x 		= _mm256_loadu_si256( (const __m256i*) &p_x[ch] );
+		x_prev 	= _mm256_loadu_si256( (const __m256i*) &p_x_prev[ch] );
+		k_rise 	= _mm256_loadu_si256( (const __m256i*) &p_k_rise[ch] );
+		k_fall 	= _mm256_loadu_si256( (const __m256i*) &p_k_fall[ch] );
+
+		// Clamp saturated change into [-k_fall, k_rise]
+		dx = _mm256_subs_epi16( x, x_prev );
+		dx = _mm256_min_epi16( _mm256_max_epi16( dx, _mm256_sub_epi16( zero, k_fall )), k_rise );
+		y = _mm256_adds_epi16( x_prev, dx );
+
+		_mm256_storeu_si256( (__m256i*) &p_x_prev[ch], y );
+		_mm256_storeu_si256( (__m256i*) &p_y[ch], y );
+	}
+
+	// Remaining channels
+	for ( ; ch < num_of_ch; ch++ )
+	{
+		p_x_prev[ch] = rate_limiter_q15_limit_sat( p_x[ch], p_x_prev[ch], p_k_rise[ch], p_k_fall[ch] );
+		p_y[ch] = p_x_prev[ch];
+	}
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/*!
+* @brief    Q15 bank update kernel, AVX-512BW, 32 channels per step
+*
+* @param[in]  	p_x			- Pointer to input signals
+* @param[out]  	p_y			- Pointer to output (slew limited) signals
+* @param[in]  	p_x_prev	- Pointer to previous values
+* @param[in]  	p_k_rise	- Pointer to rising slew rate factors
+* @param[in]  	p_k_fall	- Pointer to falling slew rate factors
+* @param[in]  	num_of_ch	- Number of channels
+* @return       void
+*/
+////////////////////////////////////////////////////////////////////////////////
+__attribute__(( target( "avx512bw" )))
+static void rate_limiter_simd_q15_avx512(const int16_t * const p_x, int16_t * const p_y, int16_t * const p_x_prev, const int16_t * const p_k_rise, const int16_t * const p_k_fall, const uint32_t num_of_ch)
+{
+	const __m512i 	zero 	= _mm512_setzero_si512();
+	__m512i			x, x_prev, k_rise, k_fall, dx, y;
+	__mmask32		mask 	= 0xFFFFFFFFUL;
+	uint32_t		ch 		= 0;
+
+	for ( ch = 0; ch < num_of_ch; ch += 32U )
+	{
+		// Mask out channels past the end
+		if (( num_of_ch - ch ) < 32U )
+		{
+			mask = (__mmask32)(( 1UL << ( num_of_ch - ch )) - 1UL );
+		}
+
+		x 		= _mm512_maskz_loadu_epi16( mask, &p_x[ch] );
+		x_prev 	= _mm512_maskz_loadu_epi16( mask, &p_x_prev[ch] );
+		k_rise 	= _mm512_maskz_loadu_epi16( mask, &p_k_rise[ch] );
+		k_fall 	= _mm512_maskz_loadu_epi16( mask, &p_k_fall[ch] );
+
+		// Clamp saturated change into [-k_fall, k_rise]
+		dx = _mm512_subs_epi16( x, x_prev );
+		dx = _mm512_min_epi16( _mm512_max_epi16( dx, _mm512_sub_epi16( zero, k_fall )), k_rise );
+		y = _mm512_adds_epi16( x_prev, dx );
+
+		_mm512_mask_storeu_epi16( &p_x_prev[ch], mask, y );
+		_mm512_mask_storeu_epi16( &p_y[ch], mask, y );
+	}
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/*!
+* @brief    Narrow float compare mask to 16-bit lanes
+*
+* @param[in]  	mask		- Float compare mask, 8 lanes
+* @return       mask		- Same mask in 16-bit lanes
+*/
+////////////////////////////////////////////////////////////////////////////////
+__attribute__(( target( "avx" )))
+static inline __m128i rate_limiter_simd_mask_to_epi16(const __m256 mask)
+{
+	return _mm_packs_epi32( _mm256_castsi256_si128( _mm256_castps_si256( mask )), _mm256_extractf128_si256( _mm256_castps_si256( mask ), 1 ));
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/*!
+* @brief    Convert floats to bfloat16 values, one per 32-bit lane
+*
+* @note Rounding is to nearest even and NaN stays quiet NaN, exactly as
+* 		"rate_limiter_f32_to_bf16()".
+*
+* @param[in]  	x			- Float values
+* @return       h			- Raw bfloat16 values in low half of lanes
+*/
+////////////////////////////////////////////////////////////////////////////////
+__attribute__(( target( "avx2" )))
+static inline __m256i rate_limiter_simd_f32_to_bf16(const __m256 x)
+{
+	const __m256i	one		= _mm256_set1_epi32( 1 );
+	const __m256i	bias	= _mm256_set1_epi32( 0x7FFF );
+	const __m256i	quiet	= _mm256_set1_epi32( 0x0040 );
+	const __m256i	u		= _mm256_castps_si256( x );
+	__m256i			h;
+
+	h = _mm256_add_epi32( _mm256_add_epi32( u, bias ), _mm256_and_si256( _mm256_srli_epi32( u, 16 ), one ));
+	h = _mm256_srli_epi32( h, 16 );
+
+	return _mm256_blendv_epi8( h, _mm256_or_si256( _mm256_srli_epi32( u, 16 ), quiet ), _mm256_castps_si256( _mm256_cmp_ps( x, x, _CMP_UNORD_Q )));
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/*!
+* @brief    Remainder resolution of fp16 values, F16C
+*
+* @note Same as "rate_limiter_fp16_res_lsb()".
+*
+* @param[in]  	h			- Raw fp16 values
+* @return       lsb			- Remainder resolutions
+*/
+////////////////////////////////////////////////////////////////////////////////
+__attribute__(( target( "avx,f16c" )))
+static inline __m256 rate_limiter_simd_fp16_res_lsb_f16c(const __m128i h)
+{
+	const __m128i h_abs = _mm_and_si128( h, _mm_set1_epi16( 0x7FFF ));
+
+	return _mm256_mul_ps( _mm256_sub_ps( _mm256_cvtph_ps( _mm_add_epi16( h_abs, _mm_set1_epi16( 1 ))), _mm256_cvtph_ps( h_abs )), _mm256_set1_ps( RATE_LIMITER_H16_RES_LSB ));
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/*!
+* @brief    16-bit storage bank update kernel, fp16 with F16C, 8 channels per step
+*
+* @param[in]  	p_x			- Pointer to input signals
+* @param[out]  	p_y			- Pointer to output (slew limited) signals
+* @param[in]  	p_x_prev	- Pointer to stored previous values
+* @param[in]  	p_x_res		- Pointer to sub-ulp remainders
+* @param[in]  	p_k_rise	- Pointer to stored rising slew rate factors
+* @param[in]  	p_k_fall	- Pointer to stored falling slew rate factors
+* @param[in]  	num_of_ch	- Number of channels
+* @return       void
+*/
+////////////////////////////////////////////////////////////////////////////////
+__attribute__(( target( "avx,f16c" )))
+static void rate_limiter_simd_fp16_f16c(const float32_t * const p_x, float32_t * const p_y, uint16_t * const p_x_prev, int16_t * const p_x_res, const uint16_t * const p_k_rise, const uint16_t * const p_k_fall, const uint32_t num_of_ch)
+{
+	const __m256 	sign 	= _mm256_set1_ps( RATE_LIMITER_SIMD_SIGN_MASK );
+	const __m256 	res_max	= _mm256_set1_ps( RATE_LIMITER_H16_RES_MAX );
+	const __m128i	one		= _mm_set1_epi16( 1 );
+	const __m128i	sign_h	= _mm_set1_epi16( (int16_t) 0x8000 );
+	const __m128i	abs_h	= _mm_set1_epi16( 0x7FFF );
+	__m256			x, h_f, res, x_prev, k_rise, k_fall, dx, y, up, down, back;
+	__m256i			res_i;
+	__m128i			h, h_dir, h_step, up_h;
+	uint32_t		ch 		= 0;
+
+	for ( ch = 0; ( ch + 8U ) <= num_of_ch; ch += 8U )
+	{
+		x 		= _mm256_loadu_ps( &p_x[ch] );
+		h		= _mm_loadu_si128((const __m128i*) &p_x_prev[ch] );
+		res_i	= _mm256_castsi128_si256( _mm_loadu_si128((const __m128i*) &p_x_res[ch] ));
+		res		= _mm256_cvtepi32_ps( _mm256_insertf128_si256( _mm256_castsi128_si256( _mm_cvtepi16_epi32( _mm256_castsi256_si128( res_i ))), _mm_cvtepi16_epi32( _mm_srli_si128( _mm256_castsi256_si128( res_i ), 8 )), 1 ));
+		k_rise 	= _mm256_cvtph_ps( _mm_loadu_si128((const __m128i*) &p_k_rise[ch] ));
+		k_fall 	= _mm256_cvtph_ps( _mm_loadu_si128((const __m128i*) &p_k_fall[ch] ));
+
+		// Position with sub-ulp remainder (see "rate_limiter_h16_pos()")
+		h_f 	= _mm256_cvtph_ps( h );
+		x_prev 	= _mm256_blendv_ps( _mm256_add_ps( h_f, _mm256_mul_ps( res, rate_limiter_simd_fp16_res_lsb_f16c( h ))), h_f, _mm256_cmp_ps( res, _mm256_setzero_ps(), _CMP_EQ_OQ ));
+
+		dx = _mm256_sub_ps( x, x_prev );
+
+		// Falling limit first, rising limit has precedence
+		y = _mm256_blendv_ps( x, _mm256_sub_ps( x_prev, k_fall ), _mm256_cmp_ps( dx, _mm256_xor_ps( k_fall, sign ), _CMP_LE_OQ ));
+		y = _mm256_blendv_ps( y, _mm256_add_ps( x_prev, k_rise ), _mm256_cmp_ps( dx, k_rise, _CMP_GE_OQ ));
+
+		// Round to storage
+		h 		= _mm256_cvtps_ph( y, _MM_FROUND_TO_NEAREST_INT );
+		h_f 	= _mm256_cvtph_ps( h );
+
+		// Moving channels rounded ahead of limited value step back (see "rate_limiter_fp16_limit()")
+		up 		= _mm256_cmp_ps( y, x_prev, _CMP_GT_OQ );
+		down 	= _mm256_cmp_ps( y, x_prev, _CMP_LT_OQ );
+		back 	= _mm256_and_ps( _mm256_cmp_ps( y, x, _CMP_NEQ_OQ ), _mm256_or_ps( _mm256_and_ps( up, _mm256_cmp_ps( h_f, y, _CMP_GT_OQ )), _mm256_and_ps( down, _mm256_cmp_ps( h_f, y, _CMP_LT_OQ ))));
+		up_h 	= rate_limiter_simd_mask_to_epi16( down );
+
+		h_dir 	= _mm_blendv_epi8( h, _mm_andnot_si128( up_h, sign_h ), _mm_cmpeq_epi16( _mm_and_si128( h, abs_h ), _mm_setzero_si128()));
+		h_step 	= _mm_sub_epi16( h_dir, _mm_or_si128( _mm_xor_si128( up_h, _mm_srai_epi16( h_dir, 15 )), one ));
+		h 		= _mm_blendv_epi8( h, h_step, rate_limiter_simd_mask_to_epi16( back ));
+		h_f 	= _mm256_cvtph_ps( h );
+
+		// Sub-ulp remainder (see "rate_limiter_h16_res()")
+		res 	= _mm256_div_ps( _mm256_sub_ps( y, h_f ), rate_limiter_simd_fp16_res_lsb_f16c( h ));
+		res 	= _mm256_and_ps( res, _mm256_and_ps( _mm256_cmp_ps( res, _mm256_xor_ps( res_max, sign ), _CMP_GT_OQ ), _mm256_cmp_ps( res, res_max, _CMP_LT_OQ )));
+		res_i 	= _mm256_cvttps_epi32( res );
+
+		// Output stored value
+		_mm_storeu_si128((__m128i*) &p_x_prev[ch], h );
+		_mm_storeu_si128((__m128i*) &p_x_res[ch], _mm_packs_epi32( _mm256_castsi256_si128( res_i ), _mm256_extractf128_si256( res_i, 1 )));
+		_mm256_storeu_ps( &p_y[ch], h_f );
+	}
+
+	// Remaining channels
+	for ( ; ch < num_of_ch; ch++ )
+	{
+		p_y[ch] = rate_limiter_fp16_limit( p_x[ch], &p_x_prev[ch], &p_x_res[ch], p_k_rise[ch], p_k_fall[ch] );
+	}
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/*!
+* @brief    Remainder resolution of fp16 values, AVX-512
+*
+* @note Same as "rate_limiter_fp16_res_lsb()".
+*
+* @param[in]  	h			- Raw fp16 values, one per 32-bit lane
+* @return       lsb			- Remainder resolutions
+*/
+////////////////////////////////////////////////////////////////////////////////
+__attribute__(( target( "avx512f" )))
+static inline __m512 rate_limiter_simd_fp16_res_lsb_avx512(const __m512i h)
+{
+	const __m512i h_abs = _mm512_and_epi32( h, _mm512_set1_epi32( 0x7FFF ));
+
+	return _mm512_mul_ps( _mm512_sub_ps( _mm512_cvtph_ps( _mm512_cvtepi32_epi16( _mm512_add_epi32( h_abs, _mm512_set1_epi32( 1 )))), _mm512_cvtph_ps( _mm512_cvtepi32_epi16( h_abs ))), _mm512_set1_ps( RATE_LIMITER_H16_RES_LSB ));
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/*!
+* @brief    16-bit storage bank update kernel, fp16 with AVX-512, 16 channels per step
+*
+* @param[in]  	p_x			- Pointer to input signals
+* @param[out]  	p_y			- Pointer to output (slew limited) signals
+* @param[in]  	p_x_prev	- Pointer to stored previous values
+* @param[in]  	p_x_res		- Pointer to sub-ulp remainders
+* @param[in]  	p_k_rise	- Pointer to stored rising slew rate factors
+* @param[in]  	p_k_fall	- Pointer to stored falling slew rate factors
+* @param[in]  	num_of_ch	- Number of channels
+* @return       void
+*/
+////////////////////////////////////////////////////////////////////////////////
+__attribute__(( target( "avx512f" )))
+static void rate_limiter_simd_fp16_avx512(const float32_t * const p_x, float32_t * const p_y, uint16_t * const p_x_prev, int16_t * const p_x_res, const uint16_t * const p_k_rise, const uint16_t * const p_k_fall, const uint32_t num_of_ch)
+{
+	const __m512	res_max	= _mm512_set1_ps( RATE_LIMITER_H16_RES_MAX );
+	const __m512i	one		= _mm512_set1_epi32( 1 );
+	const __m512i	sign_h	= _mm512_set1_epi32( 0x8000 );
+	const __m512i	abs_h	= _mm512_set1_epi32( 0x7FFF );
+	__m512			x, h_f, res, x_prev, k_rise, k_fall, dx, y;
+	__m512i			h, h_dir, h_step;
+	__mmask16		up, down, back, in_range;
+	uint32_t		ch 		= 0;
+
+	for ( ch = 0; ( ch + 16U ) <= num_of_ch; ch += 16U )
+	{
+		x 		= _mm512_loadu_ps( &p_x[ch] );
+		h 		= _mm512_cvtepu16_epi32( _mm256_loadu_si256((const __m256i*) &p_x_prev[ch] ));
+		res 	= _mm512_cvtepi32_ps( _mm512_cvtepi16_epi32( _mm256_loadu_si256((const __m256i*) &p_x_res[ch] )));
+		k_rise 	= _mm512_cvtph_ps( _mm256_loadu_si256((const __m256i*) &p_k_rise[ch] ));
+		k_fall 	= _mm512_cvtph_ps( _mm256_loadu_si256((const __m256i*) &p_k_fall[ch] ));
+
+		// Position with sub-ulp remainder (see "rate_limiter_h16_pos()")
+		h_f 	= _mm512_cvtph_ps( _mm512_cvtepi32_epi16( h ));
+		x_prev 	= _mm512_mask_blend_ps( _mm512_cmp_ps_mask( res, _mm512_setzero_ps(), _CMP_EQ_OQ ), _mm512_add_ps( h_f, _mm512_mul_ps( res, rate_limiter_simd_fp16_res_lsb_avx512( h ))), h_f );
+
+		dx = _mm512_sub_ps( x, x_prev );
+
+		// Falling limit first, rising limit has precedence
+		y = _mm512_mask_blend_ps( _mm512_cmp_ps_mask( dx, _mm512_sub_ps( _mm512_setzero_ps(), k_fall ), _CMP_LE_OQ ), x, _mm512_sub_ps( x_prev, k_fall ));
+		y = _mm512_mask_blend_ps( _mm512_cmp_ps_mask( dx, k_rise, _CMP_GE_OQ ), y, _mm512_add_ps( x_prev, k_rise ));
+
+		// Round to storage, one channel per 32-bit lane
+		h 		= _mm512_cvtepu16_epi32( _mm512_cvtps_ph( y, _MM_FROUND_TO_NEAREST_INT ));
+		h_f 	= _mm512_cvtph_ps( _mm512_cvtepi32_epi16( h ));
+
+		// Moving channels rounded ahead of limited value step back (see "rate_limiter_fp16_limit()")
+		up 		= _mm512_cmp_ps_mask( y, x_prev, _CMP_GT_OQ );
+		down 	= _mm512_cmp_ps_mask( y, x_prev, _CMP_LT_OQ );
+		back 	= (__mmask16)( _mm512_cmp_ps_mask( y, x, _CMP_NEQ_OQ ) & (( up & _mm512_cmp_ps_mask( h_f, y, _CMP_GT_OQ )) | ( down & _mm512_cmp_ps_mask( h_f, y, _CMP_LT_OQ ))));
+
+		h_dir 	= _mm512_mask_blend_epi32( _mm512_testn_epi32_mask( h, abs_h ), h, _mm512_maskz_mov_epi32( (__mmask16) ~down, sign_h ));
+		h_step 	= _mm512_mask_blend_epi32( (__mmask16)( down ^ _mm512_test_epi32_mask( h_dir, sign_h )), _mm512_sub_epi32( h_dir, one ), _mm512_add_epi32( h_dir, one ));
+		h 		= _mm512_mask_blend_epi32( back, h, h_step );
+		h_f 	= _mm512_cvtph_ps( _mm512_cvtepi32_epi16( h ));
+
+		// Sub-ulp remainder (see "rate_limiter_h16_res()")
+		res 		= _mm512_div_ps( _mm512_sub_ps( y, h_f ), rate_limiter_simd_fp16_res_lsb_avx512( h ));
+		in_range 	= (__mmask16)( _mm512_cmp_ps_mask( res, _mm512_sub_ps( _mm512_setzero_ps(), res_max ), _CMP_GT_OQ ) & _mm512_cmp_ps_mask( res, res_max, _CMP_LT_OQ ));
+
+		// Output stored value
+		_mm256_storeu_si256((__m256i*) &p_x_prev[ch], _mm512_cvtepi32_epi16( h ));
+		_mm256_storeu_si256((__m256i*) &p_x_res[ch], _mm512_cvtepi32_epi16( _mm512_maskz_cvttps_epi32( in_range, res )));
+		_mm512_storeu_ps( &p_y[ch], h_f );
+	}
+
+	// Remaining channels
+	for ( ; ch < num_of_ch; ch++ )
+	{
+		p_y[ch] = rate_limiter_fp16_limit( p_x[ch], &p_x_prev[ch], &p_x_res[ch], p_k_rise[ch], p_k_fall[ch] );
+	}
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/*!
+* @brief    Remainder resolution of bf16 values, AVX2
+*
+* @note Same as "rate_limiter_bf16_res_lsb()".
+*
+* @param[in]  	h			- Raw bf16 values, one per 32-bit lane
+* @return       lsb			- Remainder resolutions
+*/
+////////////////////////////////////////////////////////////////////////////////
+__attribute__(( target( "avx2" )))
+static inline __m256 rate_limiter_simd_bf16_res_lsb_avx2(const __m256i h)
+{
+	const __m256i h_abs = _mm256_and_si256( h, _mm256_set1_epi32( 0x7FFF ));
+
+	return _mm256_mul_ps( _mm256_sub_ps( _mm256_castsi256_ps( _mm256_slli_epi32( _mm256_add_epi32( h_abs, _mm256_set1_epi32( 1 )), 16 )), _mm256_castsi256_ps( _mm256_slli_epi32( h_abs, 16 ))), _mm256_set1_ps( RATE_LIMITER_H16_RES_LSB ));
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/*!
+* @brief    16-bit storage bank update kernel, bf16 with AVX2, 8 channels per step
+*
+* @param[in]  	p_x			- Pointer to input signals
+* @param[out]  	p_y			- Pointer to output (slew limited) signals
+* @param[in]  	p_x_prev	- Pointer to stored previous values
+* @param[in]  	p_x_res		- Pointer to sub-ulp remainders
+* @param[in]  	p_k_rise	- Pointer to stored rising slew rate factors
+* @param[in]  	p_k_fall	- Pointer to stored falling slew rate factors
+* @param[in]  	num_of_ch	- Number of channels
+* @return       void
+*/
+////////////////////////////////////////////////////////////////////////////////
+__attribute__(( target( "avx2" )))
+static void rate_limiter_simd_bf16_avx2(const float32_t * const p_x, float32_t * const p_y, uint16_t * const p_x_prev, int16_t * const p_x_res, const uint16_t * const p_k_rise, const uint16_t * const p_k_fall, const uint32_t num_of_ch)
+{
+	const __m256 	sign 	= _mm256_set1_ps( RATE_LIMITER_SIMD_SIGN_MASK );
+	const __m256 	res_max	= _mm256_set1_ps( RATE_LIMITER_H16_RES_MAX );
+	const __m256i	one		= _mm256_set1_epi32( 1 );
+	const __m256i	sign_h	= _mm256_set1_epi32( 0x8000 );
+	const __m256i	abs_h	= _mm256_set1_epi32( 0x7FFF );
+	__m256			x, h_f, res, x_prev, k_rise, k_fall, dx, y, up, down, back;
+	__m256i			h, h_dir, h_step, res_i;
+	uint32_t		ch 		= 0;
+
+	for ( ch = 0; ( ch + 8U ) <= num_of_ch; ch += 8U )
+	{
+		x 		= _mm256_loadu_ps( &p_x[ch] );
+		h		= _mm256_cvtepu16_epi32( _mm_loadu_si128((const __m128i*) &p_x_prev[ch] ));
+		res		= _mm256_cvtepi32_ps( _mm256_cvtepi16_epi32( _mm_loadu_si128((const __m128i*) &p_x_res[ch] )));
+		k_rise 	= _mm256_castsi256_ps( _mm256_slli_epi32( _mm256_cvtepu16_epi32( _mm_loadu_si128((const __m128i*) &p_k_rise[ch] )), 16 ));
+		k_fall 	= _mm256_castsi256_ps( _mm256_slli_epi32( _mm256_cvtepu16_epi32( _mm_loadu_si128((const __m128i*) &p_k_fall[ch] )), 16 ));
+
+		// Position with sub-ulp remainder (see "rate_limiter_h16_pos()")
+		h_f 	= _mm256_castsi256_ps( _mm256_slli_epi32( h, 16 ));
+		x_prev 	= _mm256_blendv_ps( _mm256_add_ps( h_f, _mm256_mul_ps( res, rate_limiter_simd_bf16_res_lsb_avx2( h ))), h_f, _mm256_cmp_ps( res, _mm256_setzero_ps(), _CMP_EQ_OQ ));
+
+		dx = _mm256_sub_ps( x, x_prev );
+
+		// Falling limit first, rising limit has precedence
+		y = _mm256_blendv_ps( x, _mm256_sub_ps( x_prev, k_fall ), _mm256_cmp_ps( dx, _mm256_xor_ps( k_fall, sign ), _CMP_LE_OQ ));
+		y = _mm256_blendv_ps( y, _mm256_add_ps( x_prev, k_rise ), _mm256_cmp_ps( dx, k_rise, _CMP_GE_OQ ));
+
+		// Round to storage, one channel per 32-bit lane
+		h 		= rate_limiter_simd_f32_to_bf16( y );
+		h_f 	= _mm256_castsi256_ps( _mm256_slli_epi32( h, 16 ));
+
+		// Moving channels rounded ahead of limited value step back (see "rate_limiter_bf16_limit()")
+		up 		= _mm256_cmp_ps( y, x_prev, _CMP_GT_OQ );
+		down 	= _mm256_cmp_ps( y, x_prev, _CMP_LT_OQ );
+		back 	= _mm256_and_ps( _mm256_cmp_ps( y, x, _CMP_NEQ_OQ ), _mm256_or_ps( _mm256_and_ps( up, _mm256_cmp_ps( h_f, y, _CMP_GT_OQ )), _mm256_and_ps( down, _mm256_cmp_ps( h_f, y, _CMP_LT_OQ ))));
+
+		h_dir 	= _mm256_blendv_epi8( h, _mm256_andnot_si256( _mm256_castps_si256( down ), sign_h ), _mm256_cmpeq_epi32( _mm256_and_si256( h, abs_h ), _mm256_setzero_si256()));
+		h_step 	= _mm256_sub_epi32( h_dir, _mm256_or_si256( _mm256_xor_si256( _mm256_castps_si256( down ), _mm256_cmpeq_epi32( _mm256_and_si256( h_dir, sign_h ), sign_h )), one ));
+		h 		= _mm256_blendv_epi8( h, h_step, _mm256_castps_si256( back ));
+		h_f 	= _mm256_castsi256_ps( _mm256_slli_epi32( h, 16 ));
+
+		// Sub-ulp remainder (see "rate_limiter_h16_res()")
+		res 	= _mm256_div_ps( _mm256_sub_ps( y, h_f ), rate_limiter_simd_bf16_res_lsb_avx2( h ));
+		res 	= _mm256_and_ps( res, _mm256_and_ps( _mm256_cmp_ps( res, _mm256_xor_ps( res_max, sign ), _CMP_GT_OQ ), _mm256_cmp_ps( res, res_max, _CMP_LT_OQ )));
+		res_i 	= _mm256_cvttps_epi32( res );
+
+		// Pack to 16-bit in channel order and output stored value
+		_mm_storeu_si128((__m128i*) &p_x_prev[ch], _mm256_castsi256_si128( _mm256_permute4x64_epi64( _mm256_packus_epi32( h, h ), 0xD8 )));
+		_mm_storeu_si128((__m128i*) &p_x_res[ch], _mm256_castsi256_si128( _mm256_permute4x64_epi64( _mm256_packs_epi32( res_i, res_i ), 0xD8 )));
+		_mm256_storeu_ps( &p_y[ch], h_f );
+	}
+
+	// Remaining channels
+	for ( ; ch < num_of_ch; ch++ )
+	{
+		p_y[ch] = rate_limiter_bf16_limit( p_x[ch], &p_x_prev[ch], &p_x_res[ch], p_k_rise[ch], p_k_fall[ch] );
+	}
+}
+
+#endif // ( 1 == RATE_LIMITER_SIMD_X86 )
+
+////////////////////////////////////////////////////////////////////////////////
+/*!
+* @brief    Get best bank update kernel for running CPU
+*
+* @return       pf_kernel	- Pointer to kernel, NULL if no SIMD kernel is available
+*/
+////////////////////////////////////////////////////////////////////////////////
+pf_rate_limiter_bank_kernel_t rate_limiter_simd_get_bank_kernel(void)
+{
+	pf_rate_limiter_bank_kernel_t pf_kernel = NULL;
+
+	#if ( 1 == RATE_LIMITER_SIMD_X86 )
+
+		__builtin_cpu_init();
+
+		if ( __builtin_cpu_supports( "avx512f" ))
+		{
+			pf_kernel = &rate_limiter_simd_avx512;
+		}
+		else if ( __builtin_cpu_supports( "avx2" ))
+		{
+			pf_kernel = &rate_limiter_simd_avx2;
+		}
+		else if ( __builtin_cpu_supports( "sse4.1" ))
+		{
+			pf_kernel = &rate_limiter_simd_sse41;
+		}
+		else
+		{
+			// No SIMD kernel...
+		}
+
+	#endif
+
+	return pf_kernel;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/*!
+* @brief    Get best Q15 bank update kernel for running CPU
+*
+* @return       pf_kernel	- Pointer to kernel, NULL if no SIMD kernel is available
+*/
+////////////////////////////////////////////////////////////////////////////////
+pf_rate_limiter_q15_bank_kernel_t rate_limiter_simd_get_q15_bank_kernel(void)
+{
+	pf_rate_limiter_q15_bank_kernel_t pf_kernel = NULL;
+
+	#if ( 1 == RATE_LIMITER_SIMD_X86 )
+
+		__builtin_cpu_init();
+
+		if ( __builtin_cpu_supports( "avx512bw" ))
+		{
+			pf_kernel = &rate_limiter_simd_q15_avx512;
+		}
+		else if ( __builtin_cpu_supports( "avx2" ))
+		{
+			pf_kernel = &rate_limiter_simd_q15_avx2;
+		}
+		else
+		{
+			// No SIMD kernel...
+		}
+
+	#endif
+
+	return pf_kernel;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/*!
+* @brief    Get best 16-bit storage bank update kernel for running CPU
+*
+* @param[in]  	format		- Storage format
+* @return       pf_kernel	- Pointer to kernel, NULL if no SIMD kernel is available
+*/
+////////////////////////////////////////////////////////////////////////////////
+pf_rate_limiter_bank16_kernel_t rate_limiter_simd_get_bank16_kernel(const rate_limiter_bank16_format_t format)
+{
+	pf_rate_limiter_bank16_kernel_t pf_kernel = NULL;
+
+	#if ( 1 == RATE_LIMITER_SIMD_X86 )
+
+		__builtin_cpu_init();
+
+		if ( eRATE_LIMITER_BANK16_BF16 == format )
+		{
+			if ( __builtin_cpu_supports( "avx2" ))
+			{
+				pf_kernel = &rate_limiter_simd_bf16_avx2;
+			}
+		}
+		else
+		{
+			if ( __builtin_cpu_supports( "avx512f" ))
+			{
+				pf_kernel = &rate_limiter_simd_fp16_avx512;
+			}
+			else if (( __builtin_cpu_supports( "avx" )) && ( __builtin_cpu_supports( "f16c" )))
+			{
+				pf_kernel = &rate_limiter_simd_fp16_f16c;
+			}
+			else
+			{
+				// No SIMD kernel...
+			}
+		}
+
+	#else
+
+		(void) format;
+
+	#endif
+
+	return pf_kernel;
+}
+
+#endif // ( 1 == RATE_LIMITER_BANK_SIMD_EN )
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+* @} <!-- END GROUP -->
+*/
+////////////////////////////////////////////////////////////////////////////////
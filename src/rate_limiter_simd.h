@@ -0,0 +1,63 @@
+// Copyright (c) 2021 Ziga Miklosic
+// All Rights Reserved
+// This software is under MIT licence (https://opensource.org/licenses/MIT)
+////////////////////////////////////////////////////////////////////////////////
+/**
+*@file      rate_limiter_simd.h
+*@brief     Rate limiter SIMD kernels with runtime CPU dispatch
+*@author    Ziga Miklosic
+*@date      19.02.2021
+*@version   V1.1.0
+*
+*@note		This is private header of rate limiter module and shall not be
+*			included by user code.
+*/
+////////////////////////////////////////////////////////////////////////////////
+/*!
+* @addtogroup RATE_LIMITER_SIMD
+* @{ <!-- BEGIN GROUP -->
+*/
+////////////////////////////////////////////////////////////////////////////////
+
+#ifndef __RATE_LIMITER_SIMD_H
+#define __RATE_LIMITER_SIMD_H
+
+////////////////////////////////////////////////////////////////////////////////
+// Includes
+////////////////////////////////////////////////////////////////////////////////
+#include "rate_limiter.h"
+#include "rate_limiter_bank16.h"
+
+////////////////////////////////////////////////////////////////////////////////
+// Definitions
+////////////////////////////////////////////////////////////////////////////////
+
+/**
+ * 	Bank update kernel
+ */
+typedef void (*pf_rate_limiter_bank_kernel_t)(const float32_t * const p_x, float32_t * const p_y, float32_t * const p_x_prev, const float32_t * const p_k_rise, const float32_t * const p_k_fall, const uint32_t num_of_ch);
+
+/**
+ * 	Q15 bank update kernel
+ */
+typedef void (*pf_rate_limiter_q15_bank_kernel_t)(const int16_t * const p_x, int16_t * const p_y, int16_t * const p_x_prev, const int16_t * const p_k_rise, const int16_t * const p_k_fall, const uint32_t num_of_ch);
+
+/**
+ * 	16-bit storage bank update kernel
+ */
+typedef void (*pf_rate_limiter_bank16_kernel_t)(const float32_t * const p_x, float32_t * const p_y, uint16_t * const p_x_prev, int16_t * const p_x_res, const uint16_t * const p_k_rise, const uint16_t * const p_k_fall, const uint32_t num_of_ch);
+
+////////////////////////////////////////////////////////////////////////////////
+// Functions
+////////////////////////////////////////////////////////////////////////////////
+pf_rate_limiter_bank_kernel_t 		rate_limiter_simd_get_bank_kernel		(void);
+pf_rate_limiter_q15_bank_kernel_t 	rate_limiter_simd_get_q15_bank_kernel	(void);
+pf_rate_limiter_bank16_kernel_t		rate_limiter_simd_get_bank16_kernel		(const rate_limiter_bank16_format_t format);
+
+#endif // __RATE_LIMITER_SIMD_H
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+* @} <!-- END GROUP -->
+*/
+////////////////////////////////////////////////////////////////////////////////
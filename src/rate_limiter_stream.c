@@ -0,0 +1,505 @@
+// Copyright (c) 2021 Ziga Miklosic
+// All Rights Reserved
+// This software is under MIT licence (https://opensource.org/licenses/MIT)
+////////////////////////////////////////////////////////////////////////////////
+/**
+*@file      rate_limiter_stream.c
+*@brief     Lock-free streaming stage around rate limiter
+*@author    Ziga Miklosic
+*@date      19.02.2021
+*@version   V1.1.0
+*
+*@section Description
+*
+*	Streaming stage connects acquisition thread, rate limiter thread and
+*	output thread with two single producer single consumer rings, one for
+*	input and one for output samples. No lock is taken on either side.
+*
+*	Ring indices are free running, each written by single side and kept
+*	on own cache line together with that side's cached copy of opposite
+*	index, so index cache lines only move when cached copy runs out.
+*
+*	Rate limiter thread processes samples in batches directly from input
+*	ring into output ring with "rate_limiter_update_block()", split only
+*	where one of the rings wraps. Samples are copied only when entering
+*	and leaving the stage.
+*
+*	Each function shall be called from its own side only: write from
+*	producer, process from rate limiter thread and read from consumer.
+*	Rate limiter instance shall not be used elsewhere while stage runs.
+*
+*	Enabled with RATE_LIMITER_STREAM_EN.
+*
+*@section Code_example
+*@code
+*
+*	static p_rate_limiter_stream_t my_stream = NULL;
+*
+*	if ( eRATE_LIMITER_OK != rate_limiter_stream_init( &my_stream, my_rl, 4096U ))
+*	{
+*		// Init failed...
+*	}
+*
+*	// Acquisition thread
+*	written = rate_limiter_stream_write( my_stream, raw_samples, num_of_samples );
+*
+*	// Rate limiter thread
+*	processed = rate_limiter_stream_process( my_stream, 256U );
+*
+*	// Output thread
+*	num_of_read = rate_limiter_stream_read( my_stream, slew_rated_samples, 256U );
+*
+*@endcode
+*
+*/
+////////////////////////////////////////////////////////////////////////////////
+/*!
+* @addtogroup RATE_LIMITER_STREAM
+* @{ <!-- BEGIN GROUP -->
+*/
+////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////
+// Includes
+////////////////////////////////////////////////////////////////////////////////
+#include "rate_limiter_stream.h"
+
+#if ( 1 == RATE_LIMITER_STREAM_EN )
+
+#include <stdatomic.h>
+#include <string.h>
+
+////////////////////////////////////////////////////////////////////////////////
+// Definitions
+////////////////////////////////////////////////////////////////////////////////
+
+/**
+ * 	Cache line size
+ */
+#define RATE_LIMITER_STREAM_LINE			( 64U )
+
+/**
+ * 	Single producer single consumer ring
+ *
+ * @note Read-only description, producer and consumer fields are each on
+ * 		own cache line.
+ */
+typedef struct
+{
+	float32_t *			p_buf;			/**<Sample buffer */
+	uint32_t			size;			/**<Capacity, power of two */
+	uint32_t			mask;			/**<Index mask */
+	uint8_t				pad_desc[ RATE_LIMITER_STREAM_LINE - sizeof( float32_t* ) - ( 2U * sizeof( uint32_t ))];
+
+	_Atomic uint32_t	head;			/**<Write index, producer owned */
+	uint32_t			tail_cache;		/**<Producer copy of read index */
+	uint8_t				pad_head[ RATE_LIMITER_STREAM_LINE - ( 2U * sizeof( uint32_t ))];
+
+	_Atomic uint32_t	tail;			/**<Read index, consumer owned */
+	uint32_t			head_cache;		/**<Consumer copy of write index */
+	uint8_t				pad_tail[ RATE_LIMITER_STREAM_LINE - ( 2U * sizeof( uint32_t ))];
+} RATE_LIMITER_ALIGNED( RATE_LIMITER_STREAM_LINE ) rate_limiter_stream_ring_t;
+
+/**
+ * 	Streaming stage
+ */
+typedef struct rate_limiter_stream_s
+{
+	rate_limiter_stream_ring_t	in;			/**<Input samples ring */
+	rate_limiter_stream_ring_t	out;		/**<Output samples ring */
+	p_rate_limiter_t			rl_inst;	/**<Rate limiter instance */
+	void *						p_mem;		/**<Unaligned allocation of stage and buffers */
+	bool						is_init;	/**<Stage initialization success flag */
+} RATE_LIMITER_ALIGNED( RATE_LIMITER_STREAM_LINE ) rate_limiter_stream_t;
+
+////////////////////////////////////////////////////////////////////////////////
+// Variables
+////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////
+// Function prototypes
+////////////////////////////////////////////////////////////////////////////////
+static void			rate_limiter_stream_ring_init	(rate_limiter_stream_ring_t * const p_ring, float32_t * const p_buf, const uint32_t size);
+static uint32_t		rate_limiter_stream_ring_space	(rate_limiter_stream_ring_t * const p_ring, const uint32_t head, const uint32_t size);
+static uint32_t		rate_limiter_stream_ring_avail	(rate_limiter_stream_ring_t * const p_ring, const uint32_t tail, const uint32_t size);
+
+////////////////////////////////////////////////////////////////////////////////
+// Functions
+////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////
+/*!
+* @brief    Initialize empty ring
+*
+* @param[in]  	p_ring		- Pointer to ring
+* @param[in]  	p_buf		- Pointer to sample buffer
+* @param[in]  	size		- Capacity, power of two
+* @return       void
+*/
+////////////////////////////////////////////////////////////////////////////////
+static void rate_limiter_stream_ring_init(rate_limiter_stream_ring_t * const p_ring, float32_t * const p_buf, const uint32_t size)
+{
+	p_ring->p_buf = p_buf;
+	p_ring->size = size;
+	p_ring->mask = ( size - 1U );
+	p_ring->tail_cache = 0U;
+	p_ring->head_cache = 0U;
+
+	atomic_init( &p_ring->head, 0U );
+	atomic_init( &p_ring->tail, 0U );
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/*!
+* @brief    Get free space of ring, producer side
+*
+* @note Read index of consumer is loaded only when cached copy does not
+* 		show enough space.
+*
+* @param[in]  	p_ring		- Pointer to ring
+* @param[in]  	head		- Current write index
+* @param[in]  	size		- Wanted number of samples
+* @return       space		- Number of free samples
+*/
+////////////////////////////////////////////////////////////////////////////////
+static uint32_t rate_limiter_stream_ring_space(rate_limiter_stream_ring_t * const p_ring, const uint32_t head, const uint32_t size)
+{
+	uint32_t space = ( p_ring->size - ( head - p_ring->tail_cache ));
+
+	if ( space < size )
+	{
+		p_ring->tail_cache = atomic_load_explicit( &p_ring->tail, memory_order_acquire );
+		space = ( p_ring->size - ( head - p_ring->tail_cache ));
+	}
+
+	return space;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/*!
+* @brief    Get available samples of ring, consumer side
+*
+* @note Write index of producer is loaded only when cached copy does not
+* 		show enough samples.
+*
+* @param[in]  	p_ring		- Pointer to ring
+* @param[in]  	tail		- Current read index
+* @param[in]  	size		- Wanted number of samples
+* @return       avail		- Number of available samples
+*/
+////////////////////////////////////////////////////////////////////////////////
+static uint32_t rate_limiter_stream_ring_avail(rate_limiter_stream_ring_t * const p_ring, const uint32_t tail, const uint32_t size)
+{
+	uint32_t avail = ( p_ring->head_cache - tail );
+
+	if ( avail < size )
+	{
+		p_ring->head_cache = atomic_load_explicit( &p_ring->head, memory_order_acquire );
+		avail = ( p_ring->head_cache - tail );
+	}
+
+	return avail;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+* @} <!-- END GROUP -->
+*/
+////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+*@addtogroup RATE_LIMITER_STREAM_API
+* @{ <!-- BEGIN GROUP -->
+*
+* 	Following function are part or rate limiter streaming stage API.
+*/
+////////////////////////////////////////////////////////////////////////////////
+
+////////////////////////////////////////////////////////////////////////////////
+/*!
+* @brief    Initialize streaming stage
+*
+* @note Both rings hold capacity samples. Stage does not take ownership
+* 		of rate limiter instance.
+*
+* @param[out]  	p_stream	- Pointer to streaming stage
+* @param[in]  	rl_inst		- Pointer to initialized rate limiter instance
+* @param[in]  	capacity	- Ring capacity in samples, power of two
+* @return       status		- Either OK or Error
+*/
+////////////////////////////////////////////////////////////////////////////////
+rate_limiter_status_t rate_limiter_stream_init(p_rate_limiter_stream_t * p_stream, p_rate_limiter_t rl_inst, const uint32_t capacity)
+{
+	rate_limiter_status_t 	status 	= eRATE_LIMITER_OK;
+	void *					p_mem	= NULL;
+	uintptr_t				addr	= 0;
+	float32_t *				p_buf	= NULL;
+
+	if 	(	( NULL != p_stream )
+		&&	( true == rate_limiter_is_init( rl_inst ))
+		&&	( capacity > 0U )
+		&&	( capacity <= 0x80000000UL )
+		&&	( 0U == ( capacity & ( capacity - 1U ))))
+	{
+		// Stage and both buffers as single block with spare space for alignment
+		p_mem = malloc( sizeof( rate_limiter_stream_t ) + ( 2U * (size_t) capacity * sizeof( float32_t )) + RATE_LIMITER_STREAM_LINE );
+
+		if ( NULL != p_mem )
+		{
+			addr = ((uintptr_t) p_mem + RATE_LIMITER_STREAM_LINE - 1U ) & ~((uintptr_t) RATE_LIMITER_STREAM_LINE - 1U );
+
+			*p_stream = (p_rate_limiter_stream_t) addr;
+			p_buf = (float32_t*)( addr + sizeof( rate_limiter_stream_t ));
+
+			rate_limiter_stream_ring_init( &(*p_stream)->in, p_buf, capacity );
+			rate_limiter_stream_ring_init( &(*p_stream)->out, ( p_buf + capacity ), capacity );
+
+			(*p_stream)->rl_inst = rl_inst;
+			(*p_stream)->p_mem = p_mem;
+
+			// Init success
+			(*p_stream)->is_init = true;
+		}
+		else
+		{
+			status = eRATE_LIMITER_ERROR;
+		}
+	}
+	else
+	{
+		status = eRATE_LIMITER_ERROR;
+	}
+
+	return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/*!
+* @brief    De-initialize streaming stage
+*
+* @note Stage memory is freed and stage pointer is set to NULL. Rate
+* 		limiter instance is left untouched.
+*
+* @param[in,out]  	p_stream	- Pointer to streaming stage
+* @return       	status		- Either OK or Error
+*/
+////////////////////////////////////////////////////////////////////////////////
+rate_limiter_status_t rate_limiter_stream_deinit(p_rate_limiter_stream_t * p_stream)
+{
+	rate_limiter_status_t status = eRATE_LIMITER_ERROR;
+
+	// Check for stage and initialization
+	if ( NULL != p_stream )
+	{
+		if ( true == rate_limiter_stream_is_init( *p_stream ))
+		{
+			(*p_stream)->is_init = false;
+
+			free( (*p_stream)->p_mem );
+			*p_stream = NULL;
+
+			status = eRATE_LIMITER_OK;
+		}
+	}
+
+	return status;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/*!
+* @brief    Get success initialization flag of streaming stage
+*
+* @param[in]  	stream		- Pointer to streaming stage
+* @return       is_init		- Success initialization flag
+*/
+////////////////////////////////////////////////////////////////////////////////
+bool rate_limiter_stream_is_init(p_rate_limiter_stream_t stream)
+{
+	bool is_init = false;
+
+	if ( NULL != stream )
+	{
+		is_init = stream->is_init;
+	}
+
+	return is_init;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/*!
+* @brief    Write input samples to streaming stage
+*
+* @note Producer side. Writes as many samples as fit into input ring.
+*
+* @param[in]  	stream		- Pointer to streaming stage
+* @param[in]  	p_x			- Pointer to input samples
+* @param[in]  	size		- Number of input samples
+* @return       written		- Number of written samples
+*/
+////////////////////////////////////////////////////////////////////////////////
+uint32_t rate_limiter_stream_write(p_rate_limiter_stream_t stream, const float32_t * const p_x, const uint32_t size)
+{
+	rate_limiter_stream_ring_t *	p_ring	= NULL;
+	uint32_t						head	= 0;
+	uint32_t						num		= 0;
+	uint32_t						first	= 0;
+
+	// Check for stage and buffer
+	if 	(	( true == rate_limiter_stream_is_init( stream ))
+		&&	( NULL != p_x ))
+	{
+		p_ring = &stream->in;
+		head = atomic_load_explicit( &p_ring->head, memory_order_relaxed );
+
+		num = rate_limiter_stream_ring_space( p_ring, head, size );
+
+		if ( num > size )
+		{
+			num = size;
+		}
+
+		// Copy up to wrap, then from start of buffer
+		first = ( p_ring->size - ( head & p_ring->mask ));
+
+		if ( first > num )
+		{
+			first = num;
+		}
+
+		memcpy( &p_ring->p_buf[ head & p_ring->mask ], p_x, ( first * sizeof( float32_t )));
+		memcpy( p_ring->p_buf, &p_x[first], (( num - first ) * sizeof( float32_t )));
+
+		atomic_store_explicit( &p_ring->head, ( head + num ), memory_order_release );
+	}
+
+	return num;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/*!
+* @brief    Process samples of streaming stage
+*
+* @note Rate limiter side. Samples are slew limited in place from input
+* 		ring to output ring, in contiguous spans between ring wraps.
+* 		Processes up to max_size samples, limited by available input and
+* 		free output space.
+*
+* @param[in]  	stream		- Pointer to streaming stage
+* @param[in]  	max_size	- Maximum number of samples (batch size)
+* @return       processed	- Number of processed samples
+*/
+////////////////////////////////////////////////////////////////////////////////
+uint32_t rate_limiter_stream_process(p_rate_limiter_stream_t stream, const uint32_t max_size)
+{
+	uint32_t	tail	= 0;
+	uint32_t	head	= 0;
+	uint32_t	num		= 0;
+	uint32_t	space	= 0;
+	uint32_t	done	= 0;
+	uint32_t	span	= 0;
+	uint32_t	r		= 0;
+	uint32_t	w		= 0;
+
+	// Check for stage
+	if ( true == rate_limiter_stream_is_init( stream ))
+	{
+		tail = atomic_load_explicit( &stream->in.tail, memory_order_relaxed );
+		head = atomic_load_explicit( &stream->out.head, memory_order_relaxed );
+
+		num = rate_limiter_stream_ring_avail( &stream->in, tail, max_size );
+		space = rate_limiter_stream_ring_space( &stream->out, head, max_size );
+
+		if ( num > space )
+		{
+			num = space;
+		}
+		if ( num > max_size )
+		{
+			num = max_size;
+		}
+
+		for ( done = 0; done < num; done += span )
+		{
+			r = (( tail + done ) & stream->in.mask );
+			w = (( head + done ) & stream->out.mask );
+
+			// Span ends at first wrap of either ring
+			span = ( num - done );
+
+			if ( span > ( stream->in.size - r ))
+			{
+				span = ( stream->in.size - r );
+			}
+			if ( span > ( stream->out.size - w ))
+			{
+				span = ( stream->out.size - w );
+			}
+
+			(void) rate_limiter_update_block( stream->rl_inst, &stream->in.p_buf[r], &stream->out.p_buf[w], span );
+		}
+
+		atomic_store_explicit( &stream->out.head, ( head + num ), memory_order_release );
+		atomic_store_explicit( &stream->in.tail, ( tail + num ), memory_order_release );
+	}
+
+	return num;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/*!
+* @brief    Read output samples from streaming stage
+*
+* @note Consumer side. Reads as many samples as available, up to size.
+*
+* @param[in]  	stream		- Pointer to streaming stage
+* @param[out]  	p_y			- Pointer to output (slew limited) samples
+* @param[in]  	size		- Maximum number of samples
+* @return       num_of_read	- Number of read samples
+*/
+////////////////////////////////////////////////////////////////////////////////
+uint32_t rate_limiter_stream_read(p_rate_limiter_stream_t stream, float32_t * const p_y, const uint32_t size)
+{
+	rate_limiter_stream_ring_t *	p_ring	= NULL;
+	uint32_t						tail	= 0;
+	uint32_t						num		= 0;
+	uint32_t						first	= 0;
+
+	// Check for stage and buffer
+	if 	(	( true == rate_limiter_stream_is_init( stream ))
+		&&	( NULL != p_y ))
+	{
+		p_ring = &stream->out;
+		tail = atomic_load_explicit( &p_ring->tail, memory_order_relaxed );
+
+		num = rate_limiter_stream_ring_avail( p_ring, tail, size );
+
+		if ( num > size )
+		{
+			num = size;
+		}
+
+		// Copy up to wrap, then from start of buffer
+		first = ( p_ring->size - ( tail & p_ring->mask ));
+
+		if ( first > num )
+		{
+			first = num;
+		}
+
+		memcpy( p_y, &p_ring->p_buf[ tail & p_ring->mask ], ( first * sizeof( float32_t )));
+		memcpy( &p_y[first], p_ring->p_buf, (( num - first ) * sizeof( float32_t )));
+
+		atomic_store_explicit( &p_ring->tail, ( tail + num ), memory_order_release );
+	}
+
+	return num;
+}
+
+#endif // ( 1 == RATE_LIMITER_STREAM_EN )
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+* @} <!-- END GROUP -->
+*/
+////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,69 @@
+// Copyright (c) 2021 Ziga Miklosic
+// All Rights Reserved
+// This software is under MIT licence (https://opensource.org/licenses/MIT)
+////////////////////////////////////////////////////////////////////////////////
+/**
+*@file      rate_limiter_stream.h
+*@brief     Lock-free streaming stage around rate limiter
+*@author    Ziga Miklosic
+*@date      19.02.2021
+*@version   V1.1.0
+*/
+////////////////////////////////////////////////////////////////////////////////
+/**
+*@addtogroup RATE_LIMITER_STREAM_API
+* @{ <!-- BEGIN GROUP -->
+*
+*/
+////////////////////////////////////////////////////////////////////////////////
+
+#ifndef __RATE_LIMITER_STREAM_H
+#define __RATE_LIMITER_STREAM_H
+
+////////////////////////////////////////////////////////////////////////////////
+// Includes
+////////////////////////////////////////////////////////////////////////////////
+#include "rate_limiter.h"
+
+////////////////////////////////////////////////////////////////////////////////
+// Definitions
+////////////////////////////////////////////////////////////////////////////////
+
+/**
+ * 	Enable lock-free streaming stage
+ *
+ * @note Requires C11 atomics. Can be overridden in "project_config.h".
+ *
+ * 	0 - Disabled
+ * 	1 - Enabled
+ */
+#ifndef RATE_LIMITER_STREAM_EN
+	#define RATE_LIMITER_STREAM_EN			( 0 )
+#endif
+
+#if ( 1 == RATE_LIMITER_STREAM_EN )
+
+/**
+ * 	Pointer to rate limiter streaming stage
+ */
+typedef struct rate_limiter_stream_s * p_rate_limiter_stream_t;
+
+////////////////////////////////////////////////////////////////////////////////
+// Functions
+////////////////////////////////////////////////////////////////////////////////
+rate_limiter_status_t	rate_limiter_stream_init	(p_rate_limiter_stream_t * p_stream, p_rate_limiter_t rl_inst, const uint32_t capacity);
+rate_limiter_status_t	rate_limiter_stream_deinit	(p_rate_limiter_stream_t * p_stream);
+bool					rate_limiter_stream_is_init	(p_rate_limiter_stream_t stream);
+uint32_t				rate_limiter_stream_write	(p_rate_limiter_stream_t stream, const float32_t * const p_x, const uint32_t size);
+uint32_t				rate_limiter_stream_process	(p_rate_limiter_stream_t stream, const uint32_t max_size);
+uint32_t				rate_limiter_stream_read	(p_rate_limiter_stream_t stream, float32_t * const p_y, const uint32_t size);
+
+#endif // ( 1 == RATE_LIMITER_STREAM_EN )
+
+#endif // __RATE_LIMITER_STREAM_H
+
+////////////////////////////////////////////////////////////////////////////////
+/**
+* @} <!-- END GROUP -->
+*/
+////////////////////////////////////////////////////////////////////////////////